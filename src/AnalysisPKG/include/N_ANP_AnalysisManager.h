@@ -433,6 +433,9 @@ class AnalysisManager
     // Gets the total time spent in the Jacobian load calculations.
     double getTotalJacobianLoadTime() const;
 
+    // Gets the total time spent writing output.
+    double getTotalOutputTime() const;
+
     // set the next solution vector pointer.  Needed for NOX...
     bool setNextSolVectorPtr (N_LAS_Vector * solVecPtr);
 
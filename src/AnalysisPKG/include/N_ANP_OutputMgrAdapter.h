@@ -51,6 +51,7 @@ using Teuchos::rcp;
 #include <Teuchos_SerialDenseMatrix.hpp>
 
 #include <N_UTL_Xyce.h>
+#include <N_UTL_Profile.h>
 #include <N_ANP_fwd.h>
 #include <N_PDS_fwd.h>
 
@@ -74,7 +75,7 @@ class OutputMgrAdapter
   public:
     OutputMgrAdapter( );
 
-    virtual ~OutputMgrAdapter() {}
+    virtual ~OutputMgrAdapter();
 
     void registerOutputMgr( N_IO_OutputMgr * outputMgrPtr )
     {
@@ -104,6 +105,10 @@ class OutputMgrAdapter
     int getDCAnalysisMaxSteps()
     { return dcAnalysisMaxSteps_; }
 
+    // Wall clock time spent in the output calls below.
+    double getOutputTime() const
+    { return outputTime_; }
+
     N_PDS_Comm * getCommPtr () {
       return outputManager_->getCommPtr();
     }
@@ -141,12 +146,15 @@ class OutputMgrAdapter
       std::vector<double> & scaled_dOdpAdjVec_,
       bool skipPrintLineOutput=false )
     {
+      Util::Profile::Region region("output");
+      const double start = outputWallTime_();
       outputManager_->output(time,
           stepAnalysisStepNumber_, stepAnalysisMaxSteps_, *stepParamVecRCPtr_,
           dcAnalysisStepNumber_, dcAnalysisMaxSteps_, *dcParamVecRCPtr_,
           & currSolutionPtr, & stateVecPtr, & storeVecPtr, objectiveVec_,
           dOdpVec_, dOdpAdjVec_, scaled_dOdpVec_, scaled_dOdpAdjVec_,
           skipPrintLineOutput);
+      outputTime_ += outputWallTime_() - start;
     }
 
     void dcOutput( 
@@ -158,11 +166,14 @@ class OutputMgrAdapter
         std::vector<double> & scaled_dOdpVec_, 
         std::vector<double> & scaled_dOdpAdjVec_)
     {
+      Util::Profile::Region region("output");
+      const double start = outputWallTime_();
       outputManager_->output(0.0,
           stepAnalysisStepNumber_, stepAnalysisMaxSteps_, *stepParamVecRCPtr_,
           dcStepNumber, dcAnalysisMaxSteps_, *dcParamVecRCPtr_,
           & currSolutionPtr, & stateVecPtr, & storeVecPtr, objectiveVec_,
             dOdpVec_, dOdpAdjVec_, scaled_dOdpVec_, scaled_dOdpAdjVec_);
+      outputTime_ += outputWallTime_() - start;
     }
 
 
@@ -178,7 +189,15 @@ class OutputMgrAdapter
 
     void finishOutput()
     {
+      Util::Profile::Region region("output");
+      const double start = outputWallTime_();
       outputManager_->finishOutput();
+      outputTime_ += outputWallTime_() - start;
+    }
+
+    void flushOutput()
+    {
+      outputManager_->flushAsyncOutput();
     }
 
     bool setupInitialConditions ( N_LAS_Vector & solnVec, N_LAS_Vector & flagVec)
@@ -188,7 +207,10 @@ class OutputMgrAdapter
 
     void outputDCOP( N_LAS_Vector & currSolutionPtr )
     {
+      Util::Profile::Region region("output");
+      const double start = outputWallTime_();
       outputManager_->outputDCOP( currSolutionPtr );
+      outputTime_ += outputWallTime_() - start;
     }
 
 
@@ -203,14 +225,20 @@ class OutputMgrAdapter
         const N_LAS_BlockVector & freqDomainSolnVecImaginary, const N_LAS_BlockVector & timeDomainStoreVec,
         const N_LAS_BlockVector & freqDomainStoreVecReal, const N_LAS_BlockVector & freqDomainStoreVecImaginary)
     {
+      Util::Profile::Region region("output");
+      const double start = outputWallTime_();
       outputManager_->outputHB(
           stepAnalysisStepNumber_, stepAnalysisMaxSteps_, *stepParamVecRCPtr_,
           timePoints, freqPoints, timeDomainSolnVec, freqDomainSolnVecReal, freqDomainSolnVecImaginary);
+      outputTime_ += outputWallTime_() - start;
     }
 
     void outputAC (double freq, const N_LAS_Vector & solnVecRealPtr, const N_LAS_Vector & solnVecImaginaryPtr)
     {
+      Util::Profile::Region region("output");
+      const double start = outputWallTime_();
       outputManager_->outputAC(freq, & solnVecRealPtr, & solnVecImaginaryPtr);
+      outputTime_ += outputWallTime_() - start;
     }
 
     void outputMORTF ( bool origSys, const double & freq, const Teuchos::SerialDenseMatrix<int, std::complex<double> >& H )
@@ -252,8 +280,13 @@ class OutputMgrAdapter
       return outputManager_->getAllNodes ();
     }
 
+  private:
+    double outputWallTime_();
+
   private:
     N_IO_OutputMgr *            outputManager_;
+    N_UTL_Timer *               outputTimer_;
+    double                      outputTime_;
     
     RefCountPtr< std::vector<SweepParam> > stepParamVecRCPtr_;
     RefCountPtr< std::vector<SweepParam> > dcParamVecRCPtr_;
@@ -364,6 +364,11 @@ class Simulator
 
   std::vector<std::string> getVariableNames();
 
+  // Wall clock seconds spent in each phase of the run, in phase order.
+  void getTimingStatistics(std::vector< std::pair<std::string, double> > & timings) const;
+
+  int getGlobalSolutionSize() const;
+
   bool simulateStep
       ( const N_DEV_ExternalSimulationData & ext_data,
         const std::map<std::string,double> & inputMap,
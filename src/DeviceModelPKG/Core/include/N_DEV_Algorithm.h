@@ -53,10 +53,12 @@
 #include <vector>
 
 #include <N_DEV_fwd.h>
+#include <N_UTL_NameTable.h>
 
 namespace Xyce {
 namespace Device {
 
+DeviceEntity *findDeviceEntity(EntityTypeIdDeviceMap::const_iterator begin, EntityTypeIdDeviceMap::const_iterator end, Util::NameId entity_id);
 DeviceEntity *findDeviceEntity(EntityTypeIdDeviceMap::const_iterator begin, EntityTypeIdDeviceMap::const_iterator end, const std::string &entity_name);
 
 void getDeviceInstances(const Device &device, std::back_insert_iterator<std::vector<DeviceInstance *> > it);
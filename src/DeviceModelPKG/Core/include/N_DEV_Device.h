@@ -53,6 +53,8 @@
 #include <vector>
 
 #include <N_DEV_fwd.h>
+#include <N_UTL_fwd.h>
+#include <N_UTL_NameTable.h>
 
 class N_LAS_Matrix;
 
@@ -76,6 +78,18 @@ struct DeviceInstanceOp: public std::unary_function<DeviceInstance *, bool>
   virtual bool operator()(DeviceInstance *instance) = 0;
 };
 
+///
+///  Selects which instances updateState and the loads evaluate, see Device::partitionInstances and
+///  Device::partitionLatentInstances.
+///
+enum InstanceSubset
+{
+  ALL_INSTANCES,                ///< Every instance, the default
+  INTERIOR_INSTANCES,           ///< Instances that only reference owned solution entries
+  BOUNDARY_INSTANCES,           ///< Instances that reference at least one ghost solution entry
+  ACTIVE_INSTANCES              ///< Instances that are not latent
+};
+
 ///
 ///  The Device class is an interface for device implementations.
 /// 
@@ -143,24 +157,24 @@ public:
   ///
   ///  Returns the device entity with the specified name
   /// 
-  ///  @param entity_name       const reference to the name of the entity
+  ///  @param entity_id         interned name of the entity, see Util::nameTable()
   /// 
   ///  @return pointer to the device entity
   /// 
   ///  @author David G. Baur  Raytheon  Sandia National Laboratories 1355 
   ///  @date   Wed Jan 29 16:39:23 2014
-  virtual DeviceEntity *findEntity(const std::string &entity_name) = 0;
+  virtual DeviceEntity *findEntity(Util::NameId entity_id) = 0;
 
   ///
   ///  Returns the device entity with the specified name
   /// 
-  ///  @param entity_name       const reference name of the entity
+  ///  @param entity_id         interned name of the entity, see Util::nameTable()
   /// 
   ///  @return const pointer to the device entity
   /// 
   ///  @author David G. Baur  Raytheon  Sandia National Laboratories 1355 
   ///  @date   Wed Jan 29 16:39:23 2014
-  virtual const DeviceEntity *findEntity(const std::string &entity_name) const = 0;
+  virtual const DeviceEntity *findEntity(Util::NameId entity_id) const = 0;
 
   ///
   ///  Creates a device model and adds it to the device's list of models
@@ -216,6 +230,67 @@ public:
     return true;
   }
 
+  ///
+  ///  Splits the instances into interior and boundary groups
+  ///
+  ///  An interior instance only references solution entries owned by this processor, so it can be evaluated before
+  ///  the ghost entries of the solution vector have arrived.
+  ///
+  ///  @param num_owned         number of owned solution entries, overlap LIDs at or above it are ghosts
+  ///
+  ///  @return false if the device cannot evaluate its instances in groups
+  ///
+  ///  @author Xyce Development Team, SNL
+  ///  @date   Sun Oct 19 2014
+  virtual bool partitionInstances(int num_owned) 
+  {
+    return false;
+  }
+
+  ///
+  ///  Restricts subsequent updateState calls to one group of instances
+  ///
+  ///  @param subset    group created by partitionInstances, ALL_INSTANCES restores the default
+  ///
+  ///  @author Xyce Development Team, SNL
+  ///  @date   Sun Oct 19 2014
+  virtual void setInstanceSubset(InstanceSubset subset) 
+  {}
+
+  ///
+  ///  Finds the instances that are not latent, for the ACTIVE_INSTANCES subset
+  ///
+  ///  A latent instance only references latent solution entries, which the nonlinear solver holds fixed, so its
+  ///  contributions to the DAE vectors do not change and it need not be evaluated.
+  ///
+  ///  @param latent_lids       nonzero for each latent overlap LID
+  ///
+  ///  @return false if the device cannot leave out its latent instances
+  ///
+  ///  @author Xyce Development Team, SNL
+  ///  @date   Sun Oct 19 2014
+  virtual bool partitionLatentInstances(const std::vector<char> &latent_lids) 
+  {
+    return false;
+  }
+
+  ///
+  ///  Adds the breakpoints of instances whose breakpoints the device schedules itself
+  ///
+  ///  Called once per time step by the device manager.  A device whose instances report their breakpoints through
+  ///  DeviceInstance::getInstanceBreakPoints has nothing to add here.
+  ///
+  ///  @param breakPointTimes   breakpoints to append to
+  ///
+  ///  @return true if the device added its instances' breakpoints
+  ///
+  ///  @author Xyce Development Team, SNL
+  ///  @date   Sun Oct 19 2014
+  virtual bool getDeviceBreakPoints(std::vector<Util::BreakPoint> &breakPointTimes)
+  {
+    return false;
+  }
+
   ///
   ///  Updates the devices secondary state information
   /// 
@@ -55,6 +55,7 @@
 #include <N_UTL_Misc.h>
 #include <N_UTL_Xyce.h>
 #include <N_UTL_Packable.h>
+#include <N_UTL_NameTable.h>
 
 
 namespace Xyce {
@@ -130,6 +131,19 @@ public:
   void setName(const std::string &name) 
   {
     name_ = name;
+    nameId_ = Util::NameTable::NONE;
+  }
+
+  // Interned id of the name, or NONE if the parser did not intern it.
+  // Not packed, so it is NONE after the block is unpacked.
+  Util::NameId getNameId() const
+  {
+    return nameId_;
+  }
+
+  void setNameId(Util::NameId name_id)
+  {
+    nameId_ = name_id;
   }
 
   const std::string &getModelName() const 
@@ -156,6 +170,7 @@ public:
 
 private:
   std::string name_;
+  Util::NameId nameId_;
   std::string modelName_;
 
 public:
@@ -140,6 +140,7 @@ public:
   virtual bool getIndexPairList(std::list<index_pair> & iplRef);
 
   virtual bool getInstanceBreakPoints (std::vector<N_UTL_BreakPoint> &breakPointTimes);
+  virtual bool breakPointsDependOnTimeOnly ();
 
   virtual bool updateSource ();
 
@@ -156,6 +157,13 @@ public:
 
   virtual bool testDAEMatrices (std::vector<std::string> & nameVec);
 
+  bool referencesOnlyOwned(int num_owned) const;
+
+  // true if the instance can be left out of the loads while the solution
+  // entries flagged in latent_lids are held fixed.  Devices that change
+  // with time on their own, not only through the solution, return false.
+  virtual bool isLatent(const std::vector<char> & latent_lids) const;
+
   virtual bool loadTrivialDAE_FMatrixStamp ();
   bool trivialStampLoader (N_LAS_Matrix * matPtr);
   bool zeroMatrixDiagonal (N_LAS_Matrix * matPtr);
@@ -515,6 +523,28 @@ inline bool DeviceInstance::getInstanceBreakPoints(std::vector<N_UTL_BreakPoint>
   return false;
 }
 
+//-----------------------------------------------------------------------------
+// Function      : DeviceInstance::breakPointsDependOnTimeOnly
+// Purpose       : Returns true if the breakpoints reported by
+//                 getInstanceBreakPoints are a function of time and the
+//                 instance parameters only.
+//
+// Special Notes : Such instances are scheduled by the device manager and
+//                 only re-queried when their next breakpoint has been
+//                 reached or their parameters change.  Devices whose
+//                 breakpoints depend on the solution history (transmission
+//                 lines, digital devices, ...) must keep the default, which
+//                 polls them every step.
+//
+// Scope         : public
+// Creator       : Xyce Development Team, SNL
+// Creation Date : 10/19/14
+//-----------------------------------------------------------------------------
+inline bool DeviceInstance::breakPointsDependOnTimeOnly()
+{
+  return false;
+}
+
 //-----------------------------------------------------------------------------
 // Function      : DeviceInstance::updateSource
 // Purpose       : virtual function for obtaining breakpoints from a device.
@@ -183,6 +183,9 @@ public:
   bool getVoltageLimiterFlag ();
   bool getPDESystemFlag ();
 
+  void setLatency(const std::vector<char> & latentLIDs);
+  void getAllVsrcLIDs(std::vector<int> & li_Pos, std::vector<int> & li_Neg, std::vector<int> & li_Bra);
+
   // setup initial conditions on devices
   bool setICs (N_LAS_Vector * tmpSolVectorPtr,
                N_LAS_Vector * tmpCurrSolVectorPtr,
@@ -284,6 +287,8 @@ public:
   bool loadBVectorsforAC (N_LAS_Vector * bVecRealPtr,
                           N_LAS_Vector * bVecImagPtr);
 
+  void checkLoadErrors();
+
   bool getBMatrixEntriesforMOR(std::vector<int>& bMatEntriesVec, std::vector<int>& bMatPosEntriesVec);
 
   // voltlim doesn't work with MPDE, but does work for DCOP and the
@@ -109,7 +109,7 @@ public:
 protected:
   typedef std::vector<InstanceType *> InstanceVector;
   typedef std::map<std::string, ModelType *, LessNoCase> ModelMap ;
-  typedef std::map<std::string, DeviceEntity *, LessNoCase> EntityMap;
+  typedef std::map<Util::NameId, DeviceEntity *> EntityMap;
 
 public:
   /**
@@ -138,6 +138,10 @@ public:
       solverState_(solver_state),
       modelMap_(),
       instanceVector_(),
+      partitionedInstanceVector_(),
+      interiorInstanceCount_(0),
+      activeInstanceVector_(),
+      instanceSubset_(ALL_INSTANCES),
       entityMap_(),
       defaultModel_(new ModelType(configuration_, ModelBlock(defaultModelName_, ""), factory_block))
   {
@@ -173,6 +177,10 @@ public:
       solverState_(solver_state),
       modelMap_(),
       instanceVector_(),
+      partitionedInstanceVector_(),
+      interiorInstanceCount_(0),
+      activeInstanceVector_(),
+      instanceSubset_(ALL_INSTANCES),
     entityMap_(),
     defaultModel_(new ModelType(configuration_, ModelBlock(defaultModelName_, model_type_name), factory_block))
   {
@@ -232,16 +240,16 @@ public:
   /**
    * Returns a pointer to the model or instance entity with the specified name
    *
-   * @param entity_name       const reference to the entity name
+   * @param entity_id         interned name of the entity
    *
    * @return pointer to the entity or 0 is not found
    *
    * @author David G. Baur  Raytheon  Sandia National Laboratories 1355 
    * @date   Tue Feb  4 10:36:44 2014
    */
-  virtual DeviceEntity *findEntity(const std::string &entity_name) /* override */ 
+  virtual DeviceEntity *findEntity(Util::NameId entity_id) /* override */ 
   {
-    EntityMap::iterator it = entityMap_.find(entity_name);
+    EntityMap::iterator it = entityMap_.find(entity_id);
     if (it != entityMap_.end())
       return (*it).second;
 
@@ -251,16 +259,16 @@ public:
   /**
    * Returns a pointer to the model or instance entity with the specified name
    *
-   * @param entity_name       const reference to the entity name
+   * @param entity_id         interned name of the entity
    *
    * @return const pointer to the entity or 0 is not found
    *
    * @author David G. Baur  Raytheon  Sandia National Laboratories 1355 
    * @date   Tue Feb  4 10:36:44 2014
    */
-  virtual const DeviceEntity *findEntity(const std::string &entity_name) const /* override */ 
+  virtual const DeviceEntity *findEntity(Util::NameId entity_id) const /* override */ 
   {
-    EntityMap::const_iterator it = entityMap_.find(entity_name);
+    EntityMap::const_iterator it = entityMap_.find(entity_id);
     if (it != entityMap_.end())
       return (*it).second;
 
@@ -337,6 +345,22 @@ public:
   virtual bool updateSources() /* override */;
   virtual bool updateState (double * solVec, double * staVec, double * stoVec)/* override */;
   virtual bool updateSecondaryState (double * staDerivVec, double * stoVec) /* override */;
+  virtual bool partitionInstances(int num_owned) /* override */;
+  virtual bool partitionLatentInstances(const std::vector<char> &latent_lids) /* override */;
+
+  /**
+   * Restricts the instance range returned by getInstanceBegin and getInstanceEnd
+   *
+   * @param subset    group created by partitionInstances or partitionLatentInstances
+   *
+   * @author Xyce Development Team, SNL
+   * @date   Sun Oct 19 2014
+   */
+  virtual void setInstanceSubset(InstanceSubset subset) /* override */
+  {
+    instanceSubset_ = subset;
+  }
+
   virtual bool loadDAEVectors (double * solVec, double * fVec, double * qVec, double * storeLeadF, double * storeLeadQ) /* override */;
   virtual bool loadDAEMatrices (N_LAS_Matrix & dFdx, N_LAS_Matrix & dQdx) /* override */;
 
@@ -371,7 +395,8 @@ protected:
    * Returns an iterator to the beginning of the vector of all instances created for this device
    *
    * While a device instance is created, the device model owns the pointer to the device.  The instanceVector_ gets a
-   * copy so that all instances of this device may be iterated over without needing to go through the model.
+   * copy so that all instances of this device may be iterated over without needing to go through the model.  After
+   * setInstanceSubset the range only covers the selected group.
    *
    * @return iterator to the beginning of the device instance vector
    *
@@ -380,6 +405,13 @@ protected:
    */
   typename InstanceVector::const_iterator getInstanceBegin() const 
   {
+    if (instanceSubset_ == INTERIOR_INSTANCES)
+      return partitionedInstanceVector_.begin();
+    else if (instanceSubset_ == BOUNDARY_INSTANCES)
+      return partitionedInstanceVector_.begin() + interiorInstanceCount_;
+    else if (instanceSubset_ == ACTIVE_INSTANCES)
+      return activeInstanceVector_.begin();
+
     return instanceVector_.begin();
   }
 
@@ -396,6 +428,13 @@ protected:
    */
   typename InstanceVector::const_iterator getInstanceEnd() const 
   {
+    if (instanceSubset_ == INTERIOR_INSTANCES)
+      return partitionedInstanceVector_.begin() + interiorInstanceCount_;
+    else if (instanceSubset_ == BOUNDARY_INSTANCES)
+      return partitionedInstanceVector_.end();
+    else if (instanceSubset_ == ACTIVE_INSTANCES)
+      return activeInstanceVector_.end();
+
     return instanceVector_.end();
   }
 
@@ -418,15 +457,15 @@ private:
    *
    * Note that currently if the name is duplicated, the previous value is overwritten.
    *
-   * @param name      const reference to the model or instance name
+   * @param name_id   interned model or instance name
    * @param entity    pointer to the model or instance
    *
    * @author David G. Baur  Raytheon  Sandia National Laboratories 1355 
    * @date   Tue Feb  4 10:35:00 2014
    */
-  void addEntity(const std::string &name, DeviceEntity *entity) 
+  void addEntity(Util::NameId name_id, DeviceEntity *entity) 
   {
-    std::pair<EntityMap::iterator, bool> result = entityMap_.insert(EntityMap::value_type(name, entity));
+    std::pair<EntityMap::iterator, bool> result = entityMap_.insert(EntityMap::value_type(name_id, entity));
     if (!result.second)
       duplicate_entity_warning(*entity);
   }
@@ -441,6 +480,10 @@ private:
   const DeviceOptions &       deviceOptions_;
   ModelMap                    modelMap_;
   InstanceVector              instanceVector_;
+  InstanceVector              partitionedInstanceVector_;     ///< Interior instances followed by boundary instances
+  size_t                      interiorInstanceCount_;
+  InstanceVector              activeInstanceVector_;          ///< Instances that are not latent
+  InstanceSubset              instanceSubset_;
   EntityMap                   entityMap_;
   ModelType * const           defaultModel_;
 };
@@ -499,7 +542,10 @@ DeviceMaster<T>::addInstance(
   InstanceType *instance = new InstanceType(configuration_, instance_block, model, factory_block);
   instance->setDefaultParamName(T::instanceDefaultParameter());
 
-  addEntity(instance_block.getName(), instance);
+  // The parser interns instance names as it expands subcircuits; blocks
+  // that came some other way are interned here.
+  const Util::NameId name_id = instance_block.getNameId();
+  addEntity(name_id != Util::NameTable::NONE ? name_id : Util::nameTable().intern(instance_block.getName()), instance);
 
   model.addInstance(instance);
 
@@ -541,7 +587,7 @@ DeviceModel *DeviceMaster<T>::addModel(
   modelMap_[model_block.name] = model;
 
   // Add model to the local processor entity list
-  addEntity(model_block.name, model);
+  addEntity(Util::nameTable().intern(model_block.name), model);
 
   return model;
 }
@@ -642,7 +688,7 @@ template<class T>
 bool DeviceMaster<T>::updateState (double * solVec, double * staVec, double * stoVec)
 {
   bool bsuccess = true;
-  for (typename InstanceVector::const_iterator it = instanceVector_.begin(); it != instanceVector_.end(); ++it)
+  for (typename InstanceVector::const_iterator it = getInstanceBegin(); it != getInstanceEnd(); ++it)
   {
     bool tmpBool = (*it)->updatePrimaryState();
     bsuccess = bsuccess && tmpBool;
@@ -672,6 +718,54 @@ bool DeviceMaster<T>::updateSecondaryState (double * staDerivVec, double * stoVe
   return bsuccess;
 }
 
+//-----------------------------------------------------------------------------
+// Function      : DeviceMaster::partitionInstances
+// Purpose       : Order the instances interior first for setInstanceSubset
+// Special Notes : Instance order within each group is preserved.
+// Scope         : public
+// Creator       : Xyce Development Team, SNL
+// Creation Date : 10/19/14
+//-----------------------------------------------------------------------------
+template<class T>
+bool DeviceMaster<T>::partitionInstances(int num_owned)
+{
+  partitionedInstanceVector_.clear();
+  partitionedInstanceVector_.reserve(instanceVector_.size());
+
+  for (typename InstanceVector::const_iterator it = instanceVector_.begin(); it != instanceVector_.end(); ++it)
+    if ((*it)->referencesOnlyOwned(num_owned))
+      partitionedInstanceVector_.push_back(*it);
+
+  interiorInstanceCount_ = partitionedInstanceVector_.size();
+
+  for (typename InstanceVector::const_iterator it = instanceVector_.begin(); it != instanceVector_.end(); ++it)
+    if (!(*it)->referencesOnlyOwned(num_owned))
+      partitionedInstanceVector_.push_back(*it);
+
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function      : DeviceMaster::partitionLatentInstances
+// Purpose       : Collect the instances that are not latent for
+//                 setInstanceSubset
+// Special Notes :
+// Scope         : public
+// Creator       : Xyce Development Team, SNL
+// Creation Date : 10/19/14
+//-----------------------------------------------------------------------------
+template<class T>
+bool DeviceMaster<T>::partitionLatentInstances(const std::vector<char> &latent_lids)
+{
+  activeInstanceVector_.clear();
+
+  for (typename InstanceVector::const_iterator it = instanceVector_.begin(); it != instanceVector_.end(); ++it)
+    if (!(*it)->isLatent(latent_lids))
+      activeInstanceVector_.push_back(*it);
+
+  return true;
+}
+
 //-----------------------------------------------------------------------------
 // Function      : DeviceMaster::loadDAEVectors
 // Purpose       :
@@ -684,7 +778,7 @@ template<class T>
 bool DeviceMaster<T>::loadDAEVectors(double * solVec, double * fVec, double * qVec, double * storeLeadF, double * storeLeadQ)
 {
   bool bsuccess = true;
-  for (typename InstanceVector::const_iterator it = instanceVector_.begin(); it != instanceVector_.end(); ++it)
+  for (typename InstanceVector::const_iterator it = getInstanceBegin(); it != getInstanceEnd(); ++it)
   {
     bool tmpBool = (*it)->loadDAEFVector();
     bsuccess = bsuccess && tmpBool;
@@ -707,7 +801,7 @@ template<class T>
 bool DeviceMaster<T>::loadDAEMatrices (N_LAS_Matrix & dFdx, N_LAS_Matrix & dQdx)
 {
   bool bsuccess = true;
-  for (typename InstanceVector::const_iterator it = instanceVector_.begin(); it != instanceVector_.end(); ++it)
+  for (typename InstanceVector::const_iterator it = getInstanceBegin(); it != getInstanceEnd(); ++it)
   {
     bool tmpBool = (*it)->loadDAEdFdx();
     bsuccess = bsuccess && tmpBool;
@@ -46,7 +46,9 @@
 #ifndef Xyce_N_DEV_DeviceMgr_h
 #define Xyce_N_DEV_DeviceMgr_h
 
+#include <functional>
 #include <map>
+#include <queue>
 #include <set>
 #include <string>
 #include <vector>
@@ -56,6 +58,7 @@
 #include <N_UTL_fwd.h>
 #include <N_ANP_fwd.h>
 
+#include <N_DEV_Device.h>
 #include <N_DEV_DeviceOptions.h>
 #include <N_DEV_DeviceSupport.h>
 #include <N_DEV_ExternData.h>
@@ -174,6 +177,7 @@ public:
   double getParamNoReduce(const std::string & name) const;
   bool findParam(const std::string & name) const;
   bool   getVsrcLIDs       (std::string & srcName, int & li_Pos, int & li_Neg, int & li_Bra);
+  void   getAllVsrcLIDs    (std::vector<int> & li_Pos, std::vector<int> & li_Neg, std::vector<int> & li_Bra);
 
   bool   updateTemperature (double val);
 
@@ -302,6 +306,10 @@ public:
   bool loadBVectorsforAC (N_LAS_Vector * bVecRealPtr,
                           N_LAS_Vector * bVecImagPtr);
 
+  // Leave the instances that only reference the flagged solution LIDs out
+  // of updateState and the loads.  No flags turns latency off.
+  void setLatency(const std::vector<char> & latentLIDs);
+
   bool getBMatrixEntriesforMOR(std::vector<int>& bMatEntriesVec, std::vector<int>& bMatPosEntriesVec);
 
   // voltlim doesn't work with MPDE, but does work for DCOP and the
@@ -463,6 +471,11 @@ public:
   // 2-level solves.  They are handled slightly differently.
   bool innerDevsConverged();
 
+  // Terminate if any processor reported an error during the loads.  For
+  // load paths that are not followed by a nonlinear solver norm, which
+  // performs this check as part of its reduction.  Collective.
+  void checkLoadErrors();
+
   // Functions needed for power node (2-level) algorithm):
 #ifdef Xyce_EXTDEV
   // for the parallel case, we need to give all the processors a copy
@@ -527,6 +540,11 @@ private:
   bool setupRawVectorPointers_ ();
   bool setupRawMatrixPointers_ ();
 
+  void queueNextBreakPoint_(DeviceInstance * instance,
+                            const std::vector<Util::BreakPoint> & breakPointTimes,
+                            std::vector<Util::BreakPoint>::size_type first);
+  void updateBreakPointQueue_(std::vector<Util::BreakPoint> & breakPointTimes);
+
 
 #ifdef Xyce_EXTDEV
   void setUpPassThroughParamsMap_();
@@ -538,6 +556,9 @@ private:
 
   bool updateDependentParameters_();
 
+  void setLatentInstanceSubset_(InstanceSubset subset);
+  bool loadDeviceDAEVectors_();
+
 #ifdef Xyce_EXTDEV
   // Do the actual solve/calculation for the external devices
   void updateExternalDevices_();
@@ -573,6 +594,13 @@ private:
   bool parameterChanged_;
 
   bool breakPointInstancesInitialized;
+  bool breakPointQueueStale_;
+  double breakPointQueueTime_;
+
+  bool devicesPartitioned_;     // interior/boundary split done for updateState
+
+  bool latencyActive_;          // latent instances are left out of the loads
+  bool latencySnapshot_;        // next vector load recomputes what they contribute
 
   double timeParamsProcessed_;
 
@@ -584,6 +612,12 @@ private:
 
   N_LAS_Vector       *  diagonalVectorPtr_;
 
+  // DAE vector contributions of the latent instances
+  N_LAS_Vector       *  latentFVectorPtr_;
+  N_LAS_Vector       *  latentQVectorPtr_;
+  N_LAS_Vector       *  latentdFdxdVpVectorPtr_;
+  N_LAS_Vector       *  latentdQdxdVpVectorPtr_;
+
   N_LAS_System        * lasSysPtr_;
 
   N_ANP_AnalysisInterface       * anaIntPtr_;
@@ -612,9 +646,20 @@ private:
   DeviceVector devicePtrVec_;
   DeviceVector pdeDevicePtrVec_;
   DeviceVector nonPdeDevicePtrVec_;
+  DeviceVector partitionedDevicePtrVec_;   // devices updated in interior and boundary passes
+  DeviceVector unpartitionedDevicePtrVec_; // devices updated only after the ghost solution arrives
+  DeviceVector latencyDevicePtrVec_;       // devices that leave out their latent instances
 
   InstanceVector instancePtrVec_;
-  InstanceVector bpInstancePtrVec_; // instances with breakpoints functions
+  InstanceVector bpInstancePtrVec_; // instances with breakpoints functions, polled every step
+  InstanceVector scheduledBPInstancePtrVec_; // instances whose breakpoints depend on time only
+
+  // Next breakpoint of each scheduled instance, earliest first.  An
+  // instance is only re-queried when its entry reaches the current time.
+  typedef std::pair<double, DeviceInstance *> ScheduledBreakPoint;
+  std::priority_queue<ScheduledBreakPoint,
+                      std::vector<ScheduledBreakPoint>,
+                      std::greater<ScheduledBreakPoint> > breakPointQueue_;
   InstanceVector pdeInstancePtrVec_;
   InstanceVector nonPdeInstancePtrVec_;
   InstanceVector mosfetInstancePtrVec_;
@@ -0,0 +1,130 @@
+//-----------------------------------------------------------------------------
+// Copyright Notice
+//
+//   Copyright 2002 Sandia Corporation. Under the terms
+//   of Contract DE-AC04-94AL85000 with Sandia Corporation, the U.S.
+//   Government retains certain rights in this software.
+//
+//    Xyce(TM) Parallel Electrical Simulator
+//    Copyright (C) 2002-2014 Sandia Corporation
+//
+//    This program is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License
+//    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// Filename       : $RCSfile: N_DEV_PWLStimulusFile.h,v $
+//
+// Purpose        : Shared, read-only binary (time,value) tables used by
+//                  PWL independent sources.
+//
+// Special Notes  : The binary layout is
+//
+//                    char    magic[8]   "XYCEPWLB"
+//                    int64   count
+//                    double  time[count]
+//                    double  value[count]
+//
+//                  in native byte order.  Times and values are stored as
+//                  separate columns so that the time column can be binary
+//                  searched without touching the values.
+//
+//                  Every source that names the same file shares one
+//                  mapping, so thousands of sources driven by the same
+//                  large stimulus cost a single copy of the data.
+//
+// Creator        : Xyce Development Team, SNL
+//
+// Creation Date  : 10/19/14
+//
+// Revision Information:
+// ---------------------
+//
+// Revision Number: $Revision: 1.1 $
+//
+// Revision Date  : $Date: 2014/10/19 00:00:00 $
+//
+// Current Owner  : $Author$
+//-----------------------------------------------------------------------------
+
+#ifndef Xyce_N_DEV_PWLStimulusFile_h
+#define Xyce_N_DEV_PWLStimulusFile_h
+
+// ---------- Standard Includes ----------
+#include <cstddef>
+#include <string>
+#include <map>
+#include <vector>
+
+namespace Xyce {
+namespace Device {
+
+//-----------------------------------------------------------------------------
+// Class         : PWLStimulusFile
+// Purpose       : Reference counted, memory-mapped PWL time/value table.
+// Special Notes : Instances are only created through acquire() and must be
+//                 handed back through release().  Where mmap is not
+//                 available the file is read into memory once instead.
+// Creator       : Xyce Development Team, SNL
+// Creation Date : 10/19/14
+//-----------------------------------------------------------------------------
+class PWLStimulusFile
+{
+public:
+  static bool isBinaryFile(const std::string & fileName);
+
+  static PWLStimulusFile * acquire(const std::string & fileName);
+  static void release(PWLStimulusFile * stimulus);
+
+  int size() const
+  { return count_; }
+
+  const double * times() const
+  { return times_; }
+
+  const double * values() const
+  { return values_; }
+
+  const std::string & fileName() const
+  { return fileName_; }
+
+private:
+  PWLStimulusFile(const std::string & fileName);
+  ~PWLStimulusFile();
+
+  // no copying
+  PWLStimulusFile(const PWLStimulusFile &);
+  PWLStimulusFile &operator=(const PWLStimulusFile &);
+
+  bool open_();
+  void close_();
+
+private:
+  std::string           fileName_;
+  int                   refCount_;
+  int                   count_;
+  const double *        times_;
+  const double *        values_;
+
+  void *                mapAddress_;    // non-null when the file is mapped
+  size_t                mapLength_;
+  std::vector<double>   buffer_;        // used when mmap is unavailable
+
+  typedef std::map<std::string, PWLStimulusFile *> StimulusMap;
+  static StimulusMap    openFiles_;
+};
+
+} // namespace Device
+} // namespace Xyce
+
+#endif
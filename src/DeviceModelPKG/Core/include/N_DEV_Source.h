@@ -85,8 +85,15 @@ public:
   double period();
 
   virtual bool getInstanceBreakPoints (std::vector<N_UTL_BreakPoint> &breakPointTimes);
+  virtual bool breakPointsDependOnTimeOnly ();
   virtual bool updateSource ();
 
+  // Source values change with time, so sources are never latent.
+  virtual bool isLatent(const std::vector<char> & latent_lids) const
+  {
+    return false;
+  }
+
   virtual bool loadBVectorsforAC(double * bVecReal, double * bVecImag ) {
     return true;
   }
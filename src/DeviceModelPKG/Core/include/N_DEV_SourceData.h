@@ -56,6 +56,7 @@
 #include <N_DEV_Device.h>
 #include <N_DEV_DeviceBlock.h>
 #include <N_UTL_BreakPoint.h>
+#include <N_DEV_PWLStimulusFile.h>
 
 // enum statements:
 // device indices:
@@ -404,6 +405,16 @@ public:
   void printOutParams ();
 #endif
 
+private:
+  int upperBound_(double t) const;
+  int findSegment_(double t);
+
+  double pointTime_(int i) const
+  { return stimulus_ ? stimulus_->times()[i] : TVVEC[i].first; }
+
+  double pointValue_(int i) const
+  { return stimulus_ ? stimulus_->values()[i] : TVVEC[i].second; }
+
 private:
   // Data Members for Class Attributes
   int NUM; //number of time,voltage pairs
@@ -412,6 +423,8 @@ private:
   double TD; //time delay
   std::vector< std::pair<double,double> > TVVEC;  // Array (time,voltage)
 
+  PWLStimulusFile *stimulus_; // shared binary (time,voltage) table, replaces TVVEC when given
+
   int loc_; //current location in time vector
   double starttime_; //absolute start time of current cycle
 
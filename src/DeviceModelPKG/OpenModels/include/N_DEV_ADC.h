@@ -123,6 +123,9 @@ public:
   bool getInstanceBreakPoints (std::vector<N_UTL_BreakPoint> &breakPointTimes);
   void acceptStep();
 
+  // Samples are taken on time, whatever the solution does.
+  bool isLatent(const std::vector<char> & latent_lids) const { return false; }
+
   bool getInstanceParamsMap(std::map<std::string,double>& paramsMap);
   int getNumberQuantLevels();
   bool setBitVectorWidth(int width);
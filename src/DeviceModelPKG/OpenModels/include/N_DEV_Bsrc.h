@@ -136,6 +136,9 @@ public:
 
   void varTypes( std::vector<char> & varTypeVec );
 
+  // The expression may depend on time.
+  bool isLatent(const std::vector<char> & latent_lids) const { return false; }
+
 public:
   // iterator reference to the bsrc model which owns this instance.
   // Getters and setters
@@ -126,6 +126,9 @@ public:
   bool updateTVVEC ( std::vector< std::pair<double, double> > const & newPairs );
   bool getInstanceBreakPoints (std::vector<N_UTL_BreakPoint> &breakPointTimes);
 
+  // The output follows its time-value pairs, whatever the solution does.
+  bool isLatent(const std::vector<char> & latent_lids) const { return false; }
+
   DeviceState * getInternalState();
   bool setInternalState( const DeviceState & state );
 
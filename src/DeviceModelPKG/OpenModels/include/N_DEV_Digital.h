@@ -128,7 +128,6 @@ public:
   bool updateIntermediateVars () { return true; };
   bool updatePrimaryState ();
   bool updateSecondaryState ();
-  bool getInstanceBreakPoints (std::vector<N_UTL_BreakPoint> &);
 
   // load functions, residual:
   bool loadDAEQVector ();
@@ -141,6 +140,12 @@ public:
   // Used to support U vs. Y syntax
   std::string getDeviceLetter ();
 
+  // Outputs switch after their delay whether or not the inputs move.
+  bool isLatent(const std::vector<char> & latent_lids) const { return false; }
+
+private:
+  void evaluateGate (bool clocking, double lastT, N_LAS_Vector & oldStaVector);
+
 public:
   // iterator reference to the model which owns this instance.
   // Getters and setters
@@ -220,6 +225,12 @@ private:
   std::vector<double> oTime;
 
   double breakTime;
+  double scheduledBreakTime;    // breakTime last handed to the Master
+
+  // Inputs the gate outputs in outL/oTime were last evaluated for.
+  bool gateEvaluated;
+  std::vector<bool> evalInpL;
+  double evalLastT;
 
   // Offsets for Jacobian
   int row_Lo;
@@ -327,24 +338,22 @@ class Master : public DeviceMaster<Traits>
 
   public:
     Master(
-    std::vector< std::pair<std::string,double> > & parNames,
       const Configuration &       configuration,
-    const FactoryBlock &        factory_block,
-    const SolverState & ss1,
-    const DeviceOptions & do1)
-      : DeviceMaster<Traits>(configuration, factory_block, ss1, do1)
-  {}
-
-  // Genie 110812. For now override nothing and use the template functions of the following
-  // from DeviceMaster.h
-  /*virtual bool updateState (double * solVec, double * staVec) ;
-    virtual bool updateSecondaryState (double * staDeriv);
-
-    // load functions:
-    virtual bool loadDAEVectors (double * solVec, double * fVec, double * qVec, double * storeLeadF, double * storeLeadQ);
-    virtual bool loadDAEMatrices (N_LAS_Matrix & dFdx, N_LAS_Matrix & dQdx);
-  */
-
+      const FactoryBlock &        factory_block,
+      const SolverState &         solver_state,
+      const DeviceOptions &       device_options)
+      : DeviceMaster<Traits>(configuration, factory_block, solver_state, device_options),
+        pendingEvents_(),
+        lastBreakPointTime_(-1.0)
+    {}
+
+    virtual bool updateState (double * solVec, double * staVec, double * stoVec) /* override */;
+    virtual bool getDeviceBreakPoints (std::vector<N_UTL_BreakPoint> & breakPointTimes) /* override */;
+
+  private:
+    // Output transitions scheduled since the last getDeviceBreakPoints call.
+    std::vector<std::pair<double, Instance *> > pendingEvents_;
+    double                                      lastBreakPointTime_;
 };
 
 void registerDevice();
@@ -170,6 +170,7 @@ private:
   double REPEATTIME;
   double T;
   double V;
+  std::string PWLFILE;
   int NUM;
   bool REPEAT;
   int TRANSIENTSOURCETYPE;
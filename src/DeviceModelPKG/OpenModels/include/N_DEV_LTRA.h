@@ -46,6 +46,8 @@
 #ifndef Xyce_N_DEV_LTRA_h
 #define Xyce_N_DEV_LTRA_h
 
+#include <deque>
+
 // ----------   Xyce Includes   ----------
 #include <N_DEV_Configuration.h>
 #include <N_DEV_DeviceMaster.h>
@@ -174,6 +176,9 @@ public:
   bool getInstanceBreakPoints (std::vector<N_UTL_BreakPoint> &breakPointTimes);
   void acceptStep();
 
+  // The line history is advanced by acceptStep, not by the solution.
+  bool isLatent(const std::vector<char> & latent_lids) const { return false; }
+
   double getMaxTimeStepSize();
 
   DeviceState * getInternalState();
@@ -193,6 +198,12 @@ private:
 
   void calculateMaxTimeStep_(void);   // Calculate a maximum time step size to minimize errors
 
+  // Recursive convolution (model flag RECURSIVE)
+  void recursiveAcceptStep_();
+  void recursiveConvolution_();
+  void recursiveHistoryValues_(double time, double * values) const;
+  void recursiveAdvanceDelayed_(double from, double to, std::vector<double> & state) const;
+
   double input1;	// accumulated excitation for port 1
   double input2;	// accumulated excitation for port 2
 
@@ -219,6 +230,24 @@ private:
 
   size_t listSize;	// Size of variables vectors above
 
+  // State of the recursive convolution.  Only the port values back to
+  // the delayed time are kept, older values live on in the per-pole
+  // states.
+  struct HistoryPoint
+  {
+    double time;
+    double v1;
+    double v2;
+    double i1;
+    double i2;
+  };
+
+  std::deque<HistoryPoint> recHistory;	// port values from the delayed time onwards
+  double recDelayedTime;	// time up to which recDelayedState is integrated
+  std::vector<double> recH1dashState;	// per pole: h1dash * v1, then h1dash * v2
+  std::vector<double> recDelayedState;	// per pole: h2 * i1, h2 * i2, h3dash * v1, h3dash * v2
+  std::vector<double> recDelayedScratch;	// delayed states advanced to the current time
+
   bool initVolt1Given;
   bool initVolt2Given;
 
@@ -398,6 +427,13 @@ private:
   double lteCalculate_ ( Instance & instance,
                          double curtime );
 
+  // recursive convolution:
+  double bessI0Scaled_(double x);
+  double bessI1xOverXScaled_(double x);
+  double recursiveKernel_(int kernel, double u);
+  bool recursiveFit_();
+  void recursiveStepSetup_(double step);
+
   double SECONDDERIV_(int i, double a, double b, double c);
 
 
@@ -466,6 +502,11 @@ private:
   bool truncNR;
   bool truncDontCut;
 
+  bool recursiveConv;           // convolve with a sum of exponentials fit
+  // of the impulse responses, updated
+  // recursively every step
+  double polesPerDecade;        // density of the poles of that fit
+
   bool resistGiven;
   bool inductGiven;
   bool conductGiven;
@@ -483,6 +524,8 @@ private:
   bool lteTimeStepControlGiven;
   bool truncNRGiven;
   bool truncDontCutGiven;
+  bool recursiveConvGiven;
+  bool polesPerDecadeGiven;
 
   // calculated parameters
   double td;           // propagation delay T - calculated
@@ -514,6 +557,15 @@ private:
 
   bool tdover;
 
+  // Sum of exponentials fit, h(u) ~ sum_k r_k e^{-p_k u}, shared pole set
+  // p_k. h2 and h3dash are fit from the delay on, u = t - td.
+  std::vector<double> recPoles;
+  std::vector<double> recH1dashResidues;
+  std::vector<double> recH2Residues;
+  std::vector<double> recH3dashResidues;
+  std::vector<double> recDecay;         // e^{-p_k h} for the current step
+  std::vector<double> recOldWeight;     // weight of the last accepted point for the current step
+
   bool restartStoredFlag;   // flag to indicate if this particular model has
   // been saved to the restart file already (restart
   // functions are instance functions, so the potential
@@ -59,6 +59,7 @@ namespace TRA {
 class Model;
 class Instance;
 class History;
+class HistoryBuffer;
 
 struct Traits : public DeviceTraits<Model, Instance>
 {
@@ -72,6 +73,105 @@ struct Traits : public DeviceTraits<Model, Instance>
   static void loadInstanceParameters(ParametricData<Instance> &instance_parameters);
 };
 
+//-----------------------------------------------------------------------------
+// Class         : History
+// Purpose       : Provide a structure to save internal state history
+// Special Notes :
+// Creator       : Tom Russo, SNL, Component Information and Models
+// Creation Date : 6/14/2001
+//-----------------------------------------------------------------------------
+class History
+{
+  friend class Instance;
+  friend class HistoryBuffer;
+  friend class Traits;public:
+  History();
+  History(const History &right);
+  History(double t, double v1, double v2);
+  ~History();
+  inline bool operator<(const double &test_t) const;
+
+private:
+  double t;
+  double v1;
+  double v2;
+};
+
+//-----------------------------------------------------------------------------
+// Class         : HistoryBuffer
+// Purpose       : Time ordered circular buffer of History records
+// Special Notes : Records are appended at the back and dropped from the
+//                 front in constant time.  The storage only grows, by
+//                 doubling, when a push finds it full, so once the delay
+//                 window has been seen no further allocation happens.
+// Creator       : Xyce Development Team, SNL
+// Creation Date : 10/19/14
+//-----------------------------------------------------------------------------
+class HistoryBuffer
+{
+public:
+  HistoryBuffer()
+    : buffer_(),
+      head_(0),
+      size_(0)
+  {}
+
+  size_t size() const
+  {
+    return size_;
+  }
+
+  bool empty() const
+  {
+    return size_ == 0;
+  }
+
+  void clear()
+  {
+    head_ = 0;
+    size_ = 0;
+  }
+
+  void reserve(size_t capacity);
+
+  const History &operator[](size_t i) const
+  {
+    size_t j = head_ + i;
+    return buffer_[j < buffer_.size() ? j : j - buffer_.size()];
+  }
+
+  History &operator[](size_t i)
+  {
+    size_t j = head_ + i;
+    return buffer_[j < buffer_.size() ? j : j - buffer_.size()];
+  }
+
+  const History &front() const
+  {
+    return (*this)[0];
+  }
+
+  const History &back() const
+  {
+    return (*this)[size_ - 1];
+  }
+
+  void push_back(const History &history);
+
+  void pop_front()
+  {
+    head_ = head_ + 1 < buffer_.size() ? head_ + 1 : 0;
+    --size_;
+  }
+
+  size_t lowerBound(double t, size_t hint) const;
+
+private:
+  std::vector<History>  buffer_;
+  size_t                head_;          ///< Physical index of the oldest record
+  size_t                size_;
+};
+
 //-----------------------------------------------------------------------------
 // Class         : Instance
 // Purpose       :
@@ -125,6 +225,9 @@ public:
   bool getInstanceBreakPoints (std::vector<N_UTL_BreakPoint> &breakPointTimes);
   void acceptStep();
 
+  // The line history is advanced by acceptStep, not by the solution.
+  bool isLatent(const std::vector<char> & latent_lids) const { return false; }
+
   double getMaxTimeStepSize();
 
   DeviceState * getInternalState();
@@ -285,7 +388,8 @@ private:
   double v2;    //
   bool first_BP_call_done;
 
-  std::vector<History> history;
+  HistoryBuffer history;
+  size_t historyCursor;         // index found by the last interpolation
   int newtonIterOld;
   double timeOld;
 
@@ -293,29 +397,6 @@ private:
   double newBreakPointTime;
 };
 
-//-----------------------------------------------------------------------------
-// Class         : History
-// Purpose       : Provide a structure to save internal state history
-// Special Notes :
-// Creator       : Tom Russo, SNL, Component Information and Models
-// Creation Date : 6/14/2001
-//-----------------------------------------------------------------------------
-class History
-{
-  friend class Instance;
-  friend class Traits;public:
-  History();
-  History(const History &right);
-  History(double t, double v1, double v2);
-  ~History();
-  inline bool operator<(const double &test_t) const;
-
-private:
-  double t;
-  double v1;
-  double v2;
-};
-
 //-----------------------------------------------------------------------------
 // Class         : Model
 // Purpose       :
@@ -167,6 +167,7 @@ private:
   double REPEATTIME;
   double T;
   double V;
+  std::string PWLFILE;
   double ACMAG;
   double ACPHASE;
 
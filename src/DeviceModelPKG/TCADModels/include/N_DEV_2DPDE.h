@@ -163,6 +163,7 @@ public:
 
   bool setupLabelIndex ();
   bool setupMinDXVector ();
+  bool setupEdgeArrays ();
 
   bool updateIntermediateVars ();
   bool updatePrimaryState ();
@@ -428,6 +429,11 @@ private:
 
   std::vector<double> EfieldVec; // electric field along an edge.
 
+  // flat copies of the mesh edge data, used by the current kernels.
+  std::vector<int>    edgeNodeAVec; // node A of an edge
+  std::vector<int>    edgeNodeBVec; // node B of an edge
+  std::vector<double> edgeLenVec;   // edge length (scaled with the mesh)
+
   std::vector<double> JnVec; // electron current density, along an edge
   std::vector<double> JpVec; // hole current density, along an edge
 
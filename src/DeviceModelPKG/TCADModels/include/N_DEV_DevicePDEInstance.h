@@ -216,6 +216,23 @@ public:
   double dJpdn1 (double p1, double p2, double E, double u, double h);
   double dJpdn2 (double p1, double p2, double E, double u, double h);
 
+  // batched versions of the above, over all edges at once.  z is +1 for
+  // electrons and -1 for holes.
+  void calcEdgeCurrents
+    (int z,
+     const std::vector<int> & nodeA, const std::vector<int> & nodeB,
+     const std::vector<double> & elen, const std::vector<double> & dens,
+     const std::vector<double> & E, const std::vector<double> & u,
+     std::vector<double> & J);
+
+  void pdEdgeCurrents
+    (int z,
+     const std::vector<int> & nodeA, const std::vector<int> & nodeB,
+     const std::vector<double> & elen, const std::vector<double> & dens,
+     const std::vector<double> & E, const std::vector<double> & u,
+     std::vector<double> & dJdn1, std::vector<double> & dJdn2,
+     std::vector<double> & dJdV1, std::vector<double> & dJdV2);
+
   // charge dependent current density calculations
   double J_qdep (double n1, double n2, double E, double u, double h, int z);
 
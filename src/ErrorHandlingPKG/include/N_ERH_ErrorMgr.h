@@ -77,6 +77,14 @@ void registerComm(Parallel::Machine comm);
 
 void safeBarrier(Parallel::Machine comm);
 
+// Errors reported on this processor so far, for folding into a collective
+// the caller already needs.
+unsigned localErrorCount();
+
+// Terminate cleanly if global_error_count, the sum or maximum of
+// localErrorCount over all processors, is nonzero.  Collective.
+void checkGlobalErrorCount(Parallel::Machine comm, unsigned global_error_count);
+
 } // namespace Report
 } // namespace Xyce
 
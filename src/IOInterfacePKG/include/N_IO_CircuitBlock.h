@@ -173,6 +173,15 @@ public:
   // circuit and in each subcircuit instance.
   bool instantiateDevices(std::string libSelect, std::string libInside);
 
+  // Instantiate the devices of one instance of this subcircuit.  The body
+  // is read from the netlist for the first instance and replayed from the
+  // saved lines for the rest, unless it includes other files.
+  bool instantiateSubcircuitDevices(std::string libSelect, std::string libInside);
+
+  // True once the body lines are saved and the netlist file is no longer
+  // needed to instantiate this subcircuit.
+  bool hasBodyTemplate() const;
+
   void fixupYDeviceNames();
 
 #ifdef Xyce_PARALLEL_MPI
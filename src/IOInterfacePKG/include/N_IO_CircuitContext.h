@@ -65,6 +65,7 @@
 #include <N_UTL_Misc.h>
 #include <N_UTL_Param.h>
 #include <N_UTL_NoCase.h>
+#include <N_UTL_NameTable.h>
 
 #include <N_UTL_Packable.h>
 #include <N_ERH_Message.h>
@@ -167,6 +168,7 @@ public:
   const std::string& getCurrentContextName() const;
   void setPrefix(std::string const& prefix);
   const std::string& getPrefix() const;
+  Util::NameId getPrefixId() const;
   std::map<std::string, std::string>* getNodeMapPtr() const;
   void setParentContextPtr( CircuitContext * const ptr );
   const CircuitContext * getParentContextPtr() const;
@@ -371,6 +373,7 @@ private:
   // Each of the following attributes is not set until pass 2, so they
   // do not need to be serialized.
   std::string subcircuitPrefix_;
+  Util::NameId subcircuitPrefixId_;       // subcircuitPrefix_ interned, NONE at the top level
   std::map<std::string, std::string> nodeMap_; // note: does not need to be serialized.
   bool resolved_;
   N_IO_OptionBlock resolvedParams_;
@@ -417,6 +420,7 @@ inline const std::string& CircuitContext::getName() const
 inline void CircuitContext::setPrefix(std::string const& prefix)
 {
   currentContextPtr_->subcircuitPrefix_ = prefix;
+  currentContextPtr_->subcircuitPrefixId_ = prefix.empty() ? Util::NameTable::NONE : Util::nameTable().intern(prefix);
 }
 
 
@@ -433,6 +437,20 @@ inline const std::string& CircuitContext::getPrefix() const
   return currentContextPtr_->subcircuitPrefix_;
 }
 
+//----------------------------------------------------------------------------
+// Function       : CircuitContext::getPrefixId
+// Purpose        : interned id of the subcircuit prefix, NONE at the top level
+// Special Notes  : Device names are interned below it, see
+//                  CircuitBlockData::instantiateDevice.
+// Scope          : public
+// Creator        : Xyce Development Team, SNL
+// Creation Date  : 10/19/14
+//----------------------------------------------------------------------------
+inline Util::NameId CircuitContext::getPrefixId() const
+{
+  return currentContextPtr_->subcircuitPrefixId_;
+}
+
 //----------------------------------------------------------------------------
 // Function       : CircuitContext::getNodeMapPtr
 // Purpose        :
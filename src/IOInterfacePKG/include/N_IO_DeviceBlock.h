@@ -103,6 +103,11 @@ public:
     deviceData_.getNodeBlock().set_id( name );
   }
 
+  void setNameId(Util::NameId name_id)
+  {
+    deviceData_.getDevBlock().setNameId(name_id);
+  }
+
   void setNetlistType( char type )
   {
     netlistType_ = type;
@@ -0,0 +1,157 @@
+//-----------------------------------------------------------------------------
+// Copyright Notice
+//
+//   Copyright 2002 Sandia Corporation. Under the terms
+//   of Contract DE-AC04-94AL85000 with Sandia Corporation, the U.S.
+//   Government retains certain rights in this software.
+//
+//    Xyce(TM) Parallel Electrical Simulator
+//    Copyright (C) 2002-2014 Sandia Corporation
+//
+//    This program is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License
+//    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// Filename       : $RCSfile: N_IO_HDF5Waveform.h,v $
+//
+// Purpose        : Buffered, chunked and compressed HDF5 waveform output
+//                  of a selectable subset of the solution vector.
+//
+// Special Notes  : Selected with .OPTIONS OUTPUT HDF5FILENAME=<name>
+//                  HDF5WAVEFORM=1.  The file layout is
+//
+//                    /Waveforms/SignalNames  [nsignal]          strings
+//                    /Waveforms/SignalGID    [nsignal]          int
+//                    /Waveforms/Time         [nstep]            double
+//                    /Waveforms/Signals      [nsignal][nstep]   double
+//
+//                  Signals is stored signal-major and chunked one signal
+//                  wide, so reading a single waveform touches only that
+//                  signal's chunks.  Samples are buffered in memory and
+//                  written in one collective operation per buffer.
+//
+// Creator        : Xyce Development Team, SNL
+//
+// Creation Date  : 10/19/14
+//
+// Revision Information:
+// ---------------------
+//
+// Revision Number: $Revision: 1.1 $
+//
+// Revision Date  : $Date: 2014/10/19 00:00:00 $
+//
+// Current Owner  : $Author$
+//-----------------------------------------------------------------------------
+
+#ifndef Xyce_N_IO_HDF5Waveform_h
+#define Xyce_N_IO_HDF5Waveform_h
+
+#include <string>
+#include <vector>
+
+#ifdef Xyce_USE_HDF5
+#include <hdf5.h>
+#endif
+
+#include <N_PDS_fwd.h>
+#include <N_UTL_fwd.h>
+
+class N_LAS_Vector;
+
+namespace Xyce {
+namespace IO {
+
+//-----------------------------------------------------------------------------
+// Class         : HDF5Waveform
+// Purpose       : Write transient waveforms to an already open HDF5 file.
+// Special Notes : All calls that touch the file are collective.
+// Creator       : Xyce Development Team, SNL
+// Creation Date : 10/19/14
+//-----------------------------------------------------------------------------
+class HDF5Waveform
+{
+public:
+  HDF5Waveform(N_PDS_Comm & comm);
+  ~HDF5Waveform();
+
+private:
+  HDF5Waveform(const HDF5Waveform &);
+  HDF5Waveform &operator=(const HDF5Waveform &);
+
+public:
+  void addSignalPattern(const std::string & pattern)
+  {
+    signalPatterns_.push_back(pattern);
+  }
+
+  void setCompressionLevel(int level)
+  {
+    compressionLevel_ = level;
+  }
+
+  void setDecimation(int decimation)
+  {
+    decimation_ = decimation > 1 ? decimation : 1;
+  }
+
+  void setBufferSteps(int steps)
+  {
+    bufferSteps_ = steps > 1 ? steps : 1;
+  }
+
+#ifdef Xyce_USE_HDF5
+  bool open(hid_t fileId, const NodeNamePairMap & allNodes, N_LAS_Vector & solnVec);
+#endif
+
+  void record(double time, const N_LAS_Vector & solnVec);
+  void flush();
+  void close();
+
+  static bool matchPattern(const std::string & pattern, const std::string & name);
+
+private:
+  bool selected_(const std::string & name) const;
+
+private:
+  N_PDS_Comm &                  comm_;
+  std::vector<std::string>      signalPatterns_;        ///< Glob patterns, empty selects all
+  int                           compressionLevel_;      ///< Deflate level, 0 disables
+  int                           decimation_;            ///< Keep every decimation_'th sample
+  int                           bufferSteps_;           ///< Samples buffered per write, also the chunk length
+
+  bool                          isOpen_;
+  int                           sampleCount_;           ///< Samples offered to record()
+
+  std::vector<int>              localIndex_;            ///< LIDs of the selected signals on this processor
+  int                           globalSignalCount_;
+  int                           signalOffset_;          ///< First global signal index owned by this processor
+
+  std::vector<double>           timeBuffer_;
+  std::vector<double>           signalBuffer_;          ///< [localSignal * bufferSteps_ + step]
+  int                           bufferedSteps_;
+  unsigned long                 writtenSteps_;
+
+#ifdef Xyce_USE_HDF5
+  hid_t                         groupId_;
+  hid_t                         timeDataSet_;
+  hid_t                         signalDataSet_;
+  hid_t                         transferPlist_;
+#endif
+};
+
+} // namespace IO
+} // namespace Xyce
+
+#endif // Xyce_N_IO_HDF5Waveform_h
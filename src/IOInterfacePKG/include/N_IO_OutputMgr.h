@@ -318,6 +318,7 @@ public:
 
   void resetOutput();
   void finishOutput();
+  void flushAsyncOutput();
 
   // if any macro-simulation level functions were defined, finish them and output results
   void outputMacroResults();
@@ -762,6 +763,7 @@ private:
 
   bool printEndOfSimulationLine_;  // flag to indicate if user wants the "End of Xyce(TM)" line in the output.
   bool outputVersionInRawFile_;    // flag to indicate that Version should be output in the header of a RAW file.
+  bool asyncOutput_;               // flag to write output files from a background writer thread.
 
   // response functions requested in the external params passed to Xyce.
   std::vector< std::pair< std::string, std::string> > variablesUsedInSimulation_ ;
@@ -822,6 +824,12 @@ private:
   bool hdf5HeaderWritten_;
   std::string hdf5FileName_;
   int hdf5IndexValue_;
+  bool hdf5WaveformMode_;
+  std::vector<std::string> hdf5SignalPatterns_;
+  int hdf5Decimation_;
+  int hdf5CompressionLevel_;
+  int hdf5BufferSteps_;
+  HDF5Waveform *hdf5Waveform_;
 
 #ifdef Xyce_USE_HDF5
   hid_t hdf5FileId_;
@@ -0,0 +1,104 @@
+//-----------------------------------------------------------------------------
+// Copyright Notice
+//
+//   Copyright 2002 Sandia Corporation. Under the terms
+//   of Contract DE-AC04-94AL85000 with Sandia Corporation, the U.S.
+//   Government retains certain rights in this software.
+//
+//    Xyce(TM) Parallel Electrical Simulator
+//    Copyright (C) 2002-2014 Sandia Corporation
+//
+//    This program is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License
+//    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// Filename       : $RCSfile: N_IO_OutputPlan.h,v $
+//
+// Purpose        : Pre-resolved evaluation plan for the columns of an
+//                  outputter.
+//
+// Special Notes  : Plain solution variable and voltage difference columns
+//                  are gathered straight out of the solution vector by
+//                  local index and reduced across processors with a single
+//                  collective.  Every other column still goes through its
+//                  Util::Operator.
+//
+// Creator        : Xyce Development Team, SNL
+//
+// Creation Date  : 10/19/14
+//
+// Revision Information:
+// ---------------------
+//
+// Revision Number: $Revision: 1.1 $
+//
+// Revision Date  : $Date: 2014/10/19 00:00:00 $
+//
+// Current Owner  : $Author$
+//-----------------------------------------------------------------------------
+
+#ifndef Xyce_N_IO_OutputPlan_h
+#define Xyce_N_IO_OutputPlan_h
+
+#include <vector>
+
+#include <N_UTL_Op.h>
+
+namespace Xyce {
+namespace IO {
+
+//-----------------------------------------------------------------------------
+// Class         : OutputPlan
+// Purpose       : Evaluate all columns of an op list at once
+// Special Notes : The plan does not own the operators.  compile() must be
+//                 called again if the op list changes.  evaluate() is
+//                 collective.
+// Creator       : Xyce Development Team, SNL
+// Creation Date : 10/19/14
+//-----------------------------------------------------------------------------
+class OutputPlan
+{
+public:
+  OutputPlan()
+  {}
+
+  void compile(const Util::OpList &op_list);
+
+  void evaluate(
+    Parallel::Machine           comm,
+    const N_LAS_Vector *        real_solution_vector,
+    const N_LAS_Vector *        imaginary_solution_vector,
+    const N_LAS_Vector *        state_vector,
+    const N_LAS_Vector *        store_vector) const;
+
+  const complex &value(int column) const
+  {
+    return values_[column];
+  }
+
+private:
+  Util::OpList                  opList_;                ///< Columns in output order, not owned
+  std::vector<int>              gatherColumn_;          ///< Column of each gathered value
+  std::vector<int>              gatherIndex_;           ///< Local index added, -1 if not on this processor
+  std::vector<int>              gatherNegIndex_;        ///< Local index subtracted, -1 if none
+  std::vector<int>              genericColumn_;         ///< Columns evaluated through their operator
+
+  mutable std::vector<complex>  gatherBuffer_;
+  mutable std::vector<complex>  values_;
+};
+
+} // namespace IO
+} // namespace Xyce
+
+#endif // Xyce_N_IO_OutputPlan_h
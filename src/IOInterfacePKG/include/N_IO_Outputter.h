@@ -73,6 +73,7 @@
 #include <N_IO_PkgOptionsMgr.h>
 #include <N_ANP_SweepParam.h>
 #include <N_IO_Objective.h>
+#include <N_IO_OutputPlan.h>
 
 
 // ---------- Trilinos Includes ----------
@@ -582,6 +583,7 @@ private:
   int                 stepCount_;
 
   Util::OpList        opList_;
+  OutputPlan          outputPlan_;
 };
 
 class FrequencyPrn : public FrequencyInterface
@@ -624,6 +626,7 @@ private:
   int                 stepCount_;
 
   Util::OpList        opList_;
+  OutputPlan          outputPlan_;
 };
 
 class TimeCSV : public TimeInterface
@@ -671,6 +674,7 @@ private:
   int                 stepCount_;
 
   Util::OpList        opList_;
+  OutputPlan          outputPlan_;
 };
 
 class FrequencyCSV : public FrequencyInterface
@@ -713,6 +717,7 @@ private:
   int                 stepCount_;
 
   Util::OpList        opList_;
+  OutputPlan          outputPlan_;
 };
 
 class TimeTecPlot : public TimeInterface
@@ -762,6 +767,7 @@ private:
   int                 index_;
 
   Util::OpList        opList_;
+  OutputPlan          outputPlan_;
 };
 
 struct FrequencyTecPlot : public FrequencyInterface
@@ -799,6 +805,7 @@ private:
   unsigned long       index_;
 
   Util::OpList        opList_;
+  OutputPlan          outputPlan_;
 };
 
 struct OverrideRaw : public Interface
@@ -912,6 +919,7 @@ private:
   bool                outputRAWTitleAndDate_;
 
   Util::OpList        opList_;
+  OutputPlan          outputPlan_;
 };
 
 struct FrequencyRaw : public FrequencyInterface
@@ -952,6 +960,7 @@ private:
   bool                outputRAWTitleAndDate_;
 
   Util::OpList        opList_;
+  OutputPlan          outputPlan_;
 };
 
 struct TimeRawAscii : public TimeInterface
@@ -995,6 +1004,7 @@ private:
   bool                outputRAWTitleAndDate_;
 
   Util::OpList        opList_;
+  OutputPlan          outputPlan_;
 };
 
 struct FrequencyRawAscii : public FrequencyInterface
@@ -1037,6 +1047,7 @@ private:
   bool                outputRAWTitleAndDate_;
 
   Util::OpList        opList_;
+  OutputPlan          outputPlan_;
 };
 
 struct OverrideRawAscii : public Interface
@@ -1149,6 +1160,7 @@ private:
   int                 index_;
 
   Util::OpList        opList_;
+  OutputPlan          outputPlan_;
 };
 
 struct FrequencyProbe : public FrequencyInterface
@@ -1188,6 +1200,7 @@ private:
   int                 index_;
 
   Util::OpList        opList_;
+  OutputPlan          outputPlan_;
 };
 
 struct HBPrn : public HBInterface
@@ -59,6 +59,7 @@ class DeviceMetadata;
 class DistributionTool;
 class FourierMgr;
 class FunctionBlock;
+class HDF5Waveform;
 class NetlistImportTool;
 class Objective;
 class OptionBlock;
@@ -47,6 +47,7 @@
 #define Xyce_N_LAS_AmesosSolver_h
 
 #include <string>
+#include <vector>
 
 #include <N_UTL_fwd.h>
 
@@ -97,8 +98,21 @@ public:
   // multiple RHS solves.
   int solve( bool ReuseFactors = false );
 
+  // Amesos class name for a linear solver type
+  static std::string amesosName( const std::string & type );
+
+  // Whether the solver type factors the distributed matrix in place
+  static bool isDistributed( const std::string & type );
+
+  // First available distributed direct solver type, or "" if none
+  static std::string distributedType();
+
 private:
 
+  // Whether A still holds the values of the current factors
+  bool unchangedSinceFactored_( const Epetra_CrsMatrix & A ) const;
+  void saveFactoredValues_( const Epetra_CrsMatrix & A );
+
   //Solver Type
   const std::string type_;
 
@@ -130,6 +144,9 @@ private:
   Epetra_CrsMatrix * origMat_;
   Epetra_Export * optExporter_;
 
+  // Matrix entries of the current factors
+  std::vector<double> factoredValues_;
+
   //Options
   N_UTL_OptionBlock * options_;
 
@@ -50,6 +50,7 @@
 #include <N_LAS_TransformTool.h>
 #include <N_UTL_fwd.h>
 #include <N_LAS_Solver.h>
+#include <N_LAS_PrecondReuse.h>
 
 class AztecOO;
 
@@ -386,6 +387,13 @@ private:
 
   Teuchos::RCP<N_LAS_Preconditioner> precond_;
 
+  // When to recompute the preconditioner
+  N_LAS_PrecondReuse precReuse_;
+
+  // Compute or keep the preconditioner, and run the iteration
+  void updatePreconditioner_( bool recompute );
+  int iterate_();
+
   // Timing tool
   N_UTL_Timer * timer_;
 
@@ -53,6 +53,7 @@
 
 #include <N_UTL_fwd.h>
 #include <N_LAS_Solver.h>
+#include <N_LAS_PrecondReuse.h>
 
 class Epetra_LinearProblem;
 class Epetra_MultiVector;
@@ -144,7 +145,7 @@ public:
   const int & getRecycleSize() const
   { return recycle_; }
   void setRecycleSize(const int & value)
-  { recycle_ = value; belosParams_->set("Recycle Size", recycle_); }
+  { recycle_ = value; belosParams_->set("Num Recycled Blocks", recycle_); }
   void resetRecycleSize()
   { setRecycleSize( recycleDefault_ ); }
 
@@ -212,6 +213,12 @@ private:
   bool isPrecSet_;
   Teuchos::RCP<N_LAS_Preconditioner> precond_;
 
+  // When to recompute the preconditioner
+  N_LAS_PrecondReuse precReuse_;
+
+  // Compute or keep the preconditioner
+  void updatePreconditioner_( bool recompute );
+
   // Belos preconditioning object.
   Teuchos::RCP<Epetra_Operator> belosPrecond_;
 
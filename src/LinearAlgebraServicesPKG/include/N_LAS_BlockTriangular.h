@@ -0,0 +1,102 @@
+//-----------------------------------------------------------------------------
+// Copyright Notice
+//
+//   Copyright 2002 Sandia Corporation. Under the terms
+//   of Contract DE-AC04-94AL85000 with Sandia Corporation, the U.S.
+//   Government retains certain rights in this software.
+//
+//    Xyce(TM) Parallel Electrical Simulator
+//    Copyright (C) 2002-2014 Sandia Corporation
+//
+//    This program is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License
+//    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// Filename       : $RCSfile: N_LAS_BlockTriangular.h,v $
+//
+// Purpose        : Block triangular form of a sparse matrix
+//
+// Special Notes  : analyze() matches each row to a column with a nonzero in
+//                  it (maximum transversal) and splits the matched pairs
+//                  into the strongly connected components of the graph in
+//                  which row i points to row i' when A(i, column of i') is
+//                  in the pattern.  The blocks come out dependencies first,
+//                  so with rows and columns grouped by block the matrix is
+//                  block lower triangular: the unknowns of block b only
+//                  enter the equations of blocks b and later.
+//
+//                  The matrix is passed in compressed row form.  Entries in
+//                  columns at or above n (ghost columns of a distributed
+//                  matrix) are left out of the graph.
+//
+// Creator        : Xyce Development Team, SNL
+//
+// Creation Date  : 10/19/14
+//
+// Revision Information:
+// ---------------------
+//
+// Revision Number: $Revision: 1.1 $
+//
+// Revision Date  : $Date: 2014/10/19 00:00:00 $
+//
+// Current Owner  : $Author$
+//-----------------------------------------------------------------------------
+
+#ifndef Xyce_N_LAS_BlockTriangular_h
+#define Xyce_N_LAS_BlockTriangular_h
+
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// Class         : N_LAS_BlockTriangular
+// Purpose       : Diagonal blocks of the block triangular form of a matrix
+// Special Notes :
+// Creator       : Xyce Development Team, SNL
+// Creation Date : 10/19/14
+//-----------------------------------------------------------------------------
+class N_LAS_BlockTriangular
+{
+public:
+  N_LAS_BlockTriangular();
+
+  // Match each column j of an n x n matrix, given by columns in Acp/Aci
+  // with Acsrc the position of each entry in values, to a row.
+  // colOfRow[i] is the column matched to row i.
+  static void maxTransversal( int n, const std::vector<int> & Acp, const std::vector<int> & Aci,
+                              const std::vector<int> & Acsrc, const double * values,
+                              std::vector<int> & colOfRow );
+
+  // Find the diagonal blocks of the n x n matrix in rows [0, n).
+  void analyze( int n, const int * rowPtr, const int * colInd, const double * values );
+
+  int size() const { return n_; }
+  int numBlocks() const { return static_cast<int>(blockStart_.size()) - 1; }
+
+  // Column matched to row i, and the block of row i and of that column
+  int colOfRow( int i ) const { return colOfRow_[i]; }
+  int blockOfRow( int i ) const { return blockOfRow_[i]; }
+  int blockOfCol( int j ) const { return blockOfRow_[rowOfCol_[j]]; }
+
+  // Rows of block b are blockRow(blockStart(b)) .. blockRow(blockStart(b+1)-1)
+  int blockStart( int b ) const { return blockStart_[b]; }
+  int blockRow( int k ) const { return blockRow_[k]; }
+
+private:
+  int n_;
+  std::vector<int> colOfRow_, rowOfCol_, blockOfRow_;
+  std::vector<int> blockStart_, blockRow_;
+};
+
+#endif // Xyce_N_LAS_BlockTriangular_h
@@ -111,6 +111,9 @@ private:
   //Repivot every time or use static pivoting
   bool repivot_;
 
+  //Refactor over flat arrays with the recorded pivot sequence
+  bool staticPivot_;
+
   //Output linear system every outputLS_ calls
   int outputLS_;
   int outputBaseLS_;
@@ -0,0 +1,214 @@
+//-----------------------------------------------------------------------------
+// Copyright Notice
+//
+//   Copyright 2002 Sandia Corporation. Under the terms
+//   of Contract DE-AC04-94AL85000 with Sandia Corporation, the U.S.
+//   Government retains certain rights in this software.
+//
+//    Xyce(TM) Parallel Electrical Simulator
+//    Copyright (C) 2002-2014 Sandia Corporation
+//
+//    This program is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License
+//    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// Filename       : $RCSfile: N_LAS_LevelLU.h,v $
+//
+// Purpose        : Sparse LU with a level scheduled, multithreaded
+//                  refactorization
+//
+// Special Notes  : factor() matches each column to a row with a nonzero in
+//                  it (maximum transversal), orders the matched pairs by
+//                  minimum degree, then factors left-looking with threshold
+//                  partial pivoting (Gilbert-Peierls), preferring the
+//                  matched row.  It keeps the pivot sequence and the L and U
+//                  patterns, and groups the columns into levels: column k
+//                  depends on column j exactly when U(j,k) is nonzero, so
+//                  the columns of one level can be factored concurrently.
+//
+//                  refactor() repeats the numeric factorization for new
+//                  values on the same pattern, running the wide leading
+//                  levels on several threads and the narrow tail on one.
+//                  If a pivot falls below the tolerance it reports failure
+//                  and the caller factors again from scratch.  It keeps the
+//                  values last factored, and recomputes only the columns
+//                  whose entries of A changed and the columns that depend
+//                  on those.  After a few refactorizations it orders again
+//                  with the columns seen to change last, so the factors of
+//                  a large linear part (a static Schur complement) are
+//                  left as they are.
+//
+//                  With single precision the off-diagonal values of L and
+//                  U are stored as float, halving the memory of the
+//                  factors; the factorization and the solves still
+//                  accumulate in double.
+//
+//                  The matrix is passed in compressed row form.
+//
+// Creator        : Xyce Development Team, SNL
+//
+// Creation Date  : 10/19/14
+//
+// Revision Information:
+// ---------------------
+//
+// Revision Number: $Revision: 1.1 $
+//
+// Revision Date  : $Date: 2014/10/19 00:00:00 $
+//
+// Current Owner  : $Author$
+//-----------------------------------------------------------------------------
+
+#ifndef Xyce_N_LAS_LevelLU_h
+#define Xyce_N_LAS_LevelLU_h
+
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// Class         : N_LAS_LevelLU
+// Purpose       : Sparse LU factors with a reusable symbolic analysis
+// Special Notes :
+// Creator       : Xyce Development Team, SNL
+// Creation Date : 10/19/14
+//-----------------------------------------------------------------------------
+class N_LAS_LevelLU
+{
+public:
+  N_LAS_LevelLU();
+
+  ~N_LAS_LevelLU();
+
+  // Number of threads used by refactor(); 1 without POSIX threads.
+  void setNumThreads( int numThreads );
+  int numThreads() const { return numThreads_; }
+
+  // Partial pivoting threshold, relative to the largest candidate.
+  void setPivotTolerance( double tol ) { pivotTol_ = tol; }
+
+  // Analyze and factor A with pivoting.  Returns 0, or k+1 if the k-th
+  // pivot column is structurally or numerically singular.
+  int factor( int n, const int * rowPtr, const int * colInd, const double * values );
+
+  // Refactor with the pivot sequence and pattern of the last factor().
+  // values must have the layout passed to factor().  Returns 0, or
+  // nonzero if a pivot became too small, in which case the factors are
+  // invalid and factor() must be called.
+  int refactor( const double * values );
+
+  // Recompute only the columns of the factors that depend on values that
+  // changed since the last factorization (default on).
+  void setPartialRefactor( bool partial ) { partial_ = partial; }
+
+  // Store the factors in single precision.  Changing it discards the
+  // factors, so the next refactor() fails and factor() must be called.
+  void setSinglePrecision( bool single );
+  bool singlePrecision() const { return single_; }
+
+  // Columns recomputed by the last factor() or refactor()
+  int numRefactoredColumns() const { return numRefactored_; }
+
+  // x = A^{-1} x
+  void solve( double * x ) const;
+
+  bool analyzed() const { return analyzed_; }
+
+  // True if this compressed row pattern is the one last factored.
+  bool samePattern( int n, const int * rowPtr, const int * colInd ) const;
+
+  int size() const { return n_; }
+  int numNonzeros() const { return static_cast<int>(csrColumn_.size()); }
+  int numFactorNonzeros() const { return static_cast<int>(Li_.size() + Ui_.size()) + n_; }
+  int numLevels() const { return static_cast<int>(levelStart_.size()) - 1; }
+  int numParallelLevels() const { return parallelLevels_; }
+
+private:
+  N_LAS_LevelLU( const N_LAS_LevelLU & );
+  N_LAS_LevelLU & operator=( const N_LAS_LevelLU & );
+
+  struct ThreadArgs;
+  struct WorkerPool;
+
+  int factor_( const double * values, bool separateChanged );
+  void order_( int n, const int * rowPtr, const int * colInd,
+               const std::vector<int> & rowOfCol, const std::vector<char> & late,
+               std::vector<int> & q ) const;
+  void schedule_();
+  int markChanged_( const double * values );
+  double refactorFlops_( bool changedOnly ) const;
+
+  // Factor column k of P*A*Q into the L and U values.  Returns false if
+  // the pivot fails the tolerance test.
+  bool refactorColumn_( int k, const double * values, double * x );
+  template <typename Scalar>
+  bool refactorColumn_( int k, const double * values, double * x,
+                        std::vector<Scalar> & Lx, std::vector<Scalar> & Ux );
+
+  template <typename Scalar>
+  void solve_( double * x, const std::vector<Scalar> & Lx, const std::vector<Scalar> & Ux ) const;
+
+  // Thread entry point for the concurrent levels
+  static void * refactorThread_( void * arg );
+
+  int n_;
+  bool analyzed_;
+  int numThreads_;
+  double pivotTol_;
+
+  // Pattern of A as factored: the column index of each compressed row entry
+  std::vector<int> csrColumn_;
+  std::vector<int> csrRowPtr_;
+
+  // Column k of P*A*Q: pivoted row indices and positions in the CSR values
+  std::vector<int> Ap_, Ai_, Asrc_;
+
+  // Column and row permutations.  q_[k] is the original column of pivot
+  // column k; pinv_[i] is the pivot step of original row i.
+  std::vector<int> q_, pinv_;
+
+  // Strictly lower L (unit diagonal) and strictly upper U by columns, in
+  // pivoted indices.  U columns are sorted ascending.
+  std::vector<int> Lp_, Li_, Up_, Ui_;
+  std::vector<double> Lx_, Ux_, Udiag_;
+
+  // Values of L and U in single precision, used in place of Lx_ and Ux_
+  bool single_;
+  std::vector<float> LxS_, UxS_;
+
+  // Columns grouped by level, and the number of leading levels wide
+  // enough to factor concurrently
+  std::vector<int> levelStart_, levelColumn_;
+  int parallelLevels_;
+
+  // Partial refactorization: values last factored, the columns the
+  // current refactorization recomputes, and the columns of A that have
+  // changed in the refactorizations since factor()
+  enum { REORDER_AFTER = 3 };
+  bool partial_;
+  std::vector<double> factoredValues_;
+  std::vector<char> dirty_;
+  int numRefactored_;
+  std::vector<char> changed_;
+  int numRefactors_;
+  bool reordered_;
+
+  // One dense work vector per thread, kept zero between columns
+  std::vector< std::vector<double> > work_;
+
+  // Threads for the concurrent levels, started by the first refactor()
+  // that needs them and kept until the thread count changes
+  WorkerPool * pool_;
+  mutable std::vector<double> solveWork_;
+};
+
+#endif // Xyce_N_LAS_LevelLU_h
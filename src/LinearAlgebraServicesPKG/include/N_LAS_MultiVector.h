@@ -147,6 +147,10 @@ public:
   // Compute the l_p norm (e.g., 2-norm is l_2)
   int lpNorm(const int p, double * result) const;
 
+  // l_p norm whose reduction also terminates the run if any processor has
+  // reported an error
+  int lpNormCheckErrors(const int p, double * result) const;
+
   // Infinity norm
   int infNorm(double * result) const;
 
@@ -217,6 +221,11 @@ public:
   bool vectorExport(N_LAS_MultiVector * vec, Epetra_Import * importer);
 
   bool importOverlap();
+
+  // Split phase importOverlap.  Only the owned entries are valid until
+  // importOverlapEnd returns.
+  bool importOverlapBegin();
+  bool importOverlapEnd();
   bool exportContribution( bool do_sum = true );
 
   // Dump vector entries to file.
@@ -304,6 +313,12 @@ private:
   // Map containing extern elements from migration
     std::map<int,double> externVectorMap_;
 
+  // Buffers of a split phase overlap import in progress
+  char * importBuffer_;
+  int importBufferLength_;
+  std::vector<double> exportBuffer_;
+  bool importPending_;
+
   // Process library error codes.
   void processError(const char *methodMsg, int error) const;
 };
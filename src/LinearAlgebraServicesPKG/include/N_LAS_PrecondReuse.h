@@ -0,0 +1,102 @@
+//-----------------------------------------------------------------------------
+// Copyright Notice
+//
+//   Copyright 2002 Sandia Corporation. Under the terms
+//   of Contract DE-AC04-94AL85000 with Sandia Corporation, the U.S.
+//   Government retains certain rights in this software.
+//
+//    Xyce(TM) Parallel Electrical Simulator
+//    Copyright (C) 2002-2014 Sandia Corporation
+//
+//    This program is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License
+//    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//-----------------------------------------------------------------------------
+
+
+//-----------------------------------------------------------------------------
+// Filename       : $RCSfile: N_LAS_PrecondReuse.h,v $
+//
+// Purpose        : When an iterative solver may keep its preconditioner
+//
+// Special Notes  : With PREC_REUSE = n the preconditioner computed for one
+//                  linear solve also serves up to n-1 following ones.  It
+//                  is recomputed early when it has gone stale: a solve
+//                  needs PREC_REUSE_RATIO times the iterations of the first
+//                  solve after the preconditioner was computed, or fails
+//                  to converge.  A failed solve on a reused preconditioner
+//                  is repeated with a fresh one.
+//
+// Creator        : Xyce Development Team, SNL
+//
+// Creation Date  : 10/19/14
+//
+// Revision Information:
+// ---------------------
+//
+// Revision Number: $Revision: 1.1 $
+//
+// Revision Date  : $Date: 2014/10/19 00:00:00 $
+//
+// Current Owner  : $Author$
+//-----------------------------------------------------------------------------
+
+#ifndef Xyce_N_LAS_PrecondReuse_h
+#define Xyce_N_LAS_PrecondReuse_h
+
+#include <N_UTL_fwd.h>
+
+//-----------------------------------------------------------------------------
+// Class         : N_LAS_PrecondReuse
+// Purpose       : Staleness policy for a kept preconditioner
+// Special Notes :
+// Creator       : Xyce Development Team, SNL
+// Creation Date : 10/19/14
+//-----------------------------------------------------------------------------
+class N_LAS_PrecondReuse
+{
+public:
+  N_LAS_PrecondReuse();
+
+  // Takes PREC_REUSE and PREC_REUSE_RATIO; false for any other parameter.
+  bool setParam( const N_UTL_Param & param );
+
+  // True if the preconditioner must be computed for the coming solve.
+  // ReuseFactors keeps a valid preconditioner whatever the policy.
+  bool recompute( bool reuseFactors ) const;
+
+  // The preconditioner was computed for the coming solve.
+  void computed();
+
+  // Records a solve.  Returns true if it failed on a reused
+  // preconditioner and should be repeated with a fresh one.
+  bool solved( int iterations, bool converged );
+
+  // Preconditioners computed and solves done with them
+  int numComputed() const { return numComputed_; }
+  int numSolves() const { return numSolves_; }
+
+private:
+  int maxReuse_;
+  double ratio_;
+
+  bool valid_;
+  bool stale_;
+  bool fresh_;
+  int solvesSinceCompute_;
+  int baseIterations_;
+
+  int numComputed_;
+  int numSolves_;
+};
+
+#endif // Xyce_N_LAS_PrecondReuse_h
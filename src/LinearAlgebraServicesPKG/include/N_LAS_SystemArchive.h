@@ -0,0 +1,168 @@
+//-----------------------------------------------------------------------------
+// Copyright Notice
+//
+//   Copyright 2002 Sandia Corporation. Under the terms
+//   of Contract DE-AC04-94AL85000 with Sandia Corporation, the U.S.
+//   Government retains certain rights in this software.
+//
+//    Xyce(TM) Parallel Electrical Simulator
+//    Copyright (C) 2002-2014 Sandia Corporation
+//
+//    This program is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License
+//    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// Filename       : $RCSfile: N_LAS_SystemArchive.h,v $
+//
+// Purpose        : Binary archive of linear systems captured from a run,
+//                  read back by the linear solver replay benchmark.
+//
+// Special Notes  : The file is a header ("XYCELSA" and a format version)
+//                  followed by one record per system:
+//
+//                    int    numRows, numNonzeros, step, iteration
+//                    int    rowPtr[numRows + 1]
+//                    int    colInd[numNonzeros]
+//                    double values[numNonzeros]
+//                    double rhs[numRows]
+//
+//                  in the byte order of the machine that wrote it.
+//                  Distributed systems are gathered onto processor 0 the
+//                  same way the KSparse solver does, so the archive always
+//                  holds the global system.
+//
+// Creator        : Xyce Development Team, SNL
+//
+// Creation Date  : 10/19/14
+//
+// Revision Information:
+// ---------------------
+//
+// Revision Number: $Revision: 1.1 $
+//
+// Revision Date  : $Date: 2014/10/19 00:00:00 $
+//
+// Current Owner  : $Author$
+//-----------------------------------------------------------------------------
+
+#ifndef Xyce_N_LAS_SystemArchive_h
+#define Xyce_N_LAS_SystemArchive_h
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <Teuchos_RCP.hpp>
+
+class Epetra_CrsMatrix;
+class Epetra_MultiVector;
+class Epetra_Map;
+class Epetra_Import;
+
+//-----------------------------------------------------------------------------
+// Class         : N_LAS_ArchivedSystem
+// Purpose       : One linear system in compressed row form
+// Special Notes :
+// Creator       : Xyce Development Team, SNL
+// Creation Date : 10/19/14
+//-----------------------------------------------------------------------------
+struct N_LAS_ArchivedSystem
+{
+  N_LAS_ArchivedSystem()
+    : step(0),
+      iteration(0)
+  {}
+
+  int numRows() const { return rhs.size(); }
+  int numNonzeros() const { return values.size(); }
+
+  int                   step;           ///< Output step the system came from
+  int                   iteration;      ///< Newton iteration within the step
+  std::vector<int>      rowPtr;
+  std::vector<int>      colInd;
+  std::vector<double>   values;
+  std::vector<double>   rhs;
+};
+
+//-----------------------------------------------------------------------------
+// Class         : N_LAS_SystemArchiveWriter
+// Purpose       : Sample linear systems from a run into an archive
+// Special Notes : Every offered system counts towards the sampling stride,
+//                 every "every"-th one is written until "max" have been.
+//                 offer() is collective over the communicator of the matrix.
+// Creator       : Xyce Development Team, SNL
+// Creation Date : 10/19/14
+//-----------------------------------------------------------------------------
+class N_LAS_SystemArchiveWriter
+{
+public:
+  N_LAS_SystemArchiveWriter( const std::string & path, int every = 1, int max = 100 );
+
+  ~N_LAS_SystemArchiveWriter();
+
+  // Write the system if it falls on the sampling stride.  Returns true if written.
+  bool offer( const Epetra_CrsMatrix & A, const Epetra_MultiVector & b, int step, int iteration );
+
+  int numOffered() const { return numOffered_; }
+  int numWritten() const { return numWritten_; }
+
+  bool done() const { return numWritten_ >= max_; }
+
+private:
+  N_LAS_SystemArchiveWriter( const N_LAS_SystemArchiveWriter & );
+  N_LAS_SystemArchiveWriter & operator=( const N_LAS_SystemArchiveWriter & );
+
+  bool write_( const Epetra_CrsMatrix & A, const Epetra_MultiVector & b, int step, int iteration );
+
+  std::string   path_;
+  FILE *        file_;
+  bool          opened_;
+  int           every_;
+  int           max_;
+  int           numOffered_;
+  int           numWritten_;
+
+  // Gather onto processor 0 for distributed systems.
+  Teuchos::RCP<Epetra_Map>              serialMap_;
+  Teuchos::RCP<Epetra_Import>           serialImporter_;
+};
+
+//-----------------------------------------------------------------------------
+// Class         : N_LAS_SystemArchiveReader
+// Purpose       : Read back the systems of an archive in order
+// Special Notes :
+// Creator       : Xyce Development Team, SNL
+// Creation Date : 10/19/14
+//-----------------------------------------------------------------------------
+class N_LAS_SystemArchiveReader
+{
+public:
+  N_LAS_SystemArchiveReader( const std::string & path );
+
+  ~N_LAS_SystemArchiveReader();
+
+  // False if the file could not be opened or is not an archive.
+  bool isValid() const { return file_ != 0; }
+
+  // Read the next system, false at the end of the archive.
+  bool read( N_LAS_ArchivedSystem & system );
+
+private:
+  N_LAS_SystemArchiveReader( const N_LAS_SystemArchiveReader & );
+  N_LAS_SystemArchiveReader & operator=( const N_LAS_SystemArchiveReader & );
+
+  FILE *        file_;
+};
+
+#endif
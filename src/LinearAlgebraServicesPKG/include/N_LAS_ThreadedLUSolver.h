@@ -0,0 +1,186 @@
+//-----------------------------------------------------------------------------
+// Copyright Notice
+//
+//   Copyright 2002 Sandia Corporation. Under the terms
+//   of Contract DE-AC04-94AL85000 with Sandia Corporation, the U.S.
+//   Government retains certain rights in this software.
+//
+//    Xyce(TM) Parallel Electrical Simulator
+//    Copyright (C) 2002-2014 Sandia Corporation
+//
+//    This program is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License
+//    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// Filename       : $RCSfile: N_LAS_ThreadedLUSolver.h,v $
+//
+// Purpose        : Multithreaded sparse direct linear solver interface
+//
+// Special Notes  : Linear solver type THREADLU.  The pivot sequence and
+//                  factor pattern are kept across solves; each new matrix
+//                  is refactored on THREADLU_THREADS threads, and only
+//                  repivoted when a pivot falls below THREADLU_PIVOT_TOL
+//                  or the matrix pattern changes.  With THREADLU_PARTIAL
+//                  only the part of the factors that depends on entries
+//                  changed since the last solve is recomputed.
+//
+//                  With THREADLU_SINGLE the factors are stored in single
+//                  precision and each solution is refined against the
+//                  double precision matrix, for at most THREADLU_REFINE_MAX
+//                  steps.  If refinement stalls the matrix is factored in
+//                  double, and the solver stays in double from then on.
+//
+// Creator        : Xyce Development Team, SNL
+//
+// Creation Date  : 10/19/14
+//
+// Revision Information:
+// ---------------------
+//
+// Revision Number: $Revision: 1.1 $
+//
+// Revision Date  : $Date: 2014/10/19 00:00:00 $
+//
+// Current Owner  : $Author$
+//-----------------------------------------------------------------------------
+
+#ifndef Xyce_N_LAS_ThreadedLUSolver_h
+#define Xyce_N_LAS_ThreadedLUSolver_h
+
+// ---------- Standard Includes ----------
+
+#include <string>
+#include <vector>
+
+#include <N_UTL_fwd.h>
+
+class Epetra_LinearProblem;
+class Epetra_CrsMatrix;
+class Epetra_Import;
+class Epetra_Map;
+class Epetra_MultiVector;
+
+// ----------   Xyce Includes   ----------
+
+#include <N_LAS_Solver.h>
+#include <N_LAS_LevelLU.h>
+#include <Teuchos_RCP.hpp>
+
+class N_LAS_Problem;
+class N_LAS_Transform;
+
+//-----------------------------------------------------------------------------
+// Class         : N_LAS_ThreadedLUSolver
+// Purpose       :
+// Special Notes :
+// Creator       : Xyce Development Team, SNL
+// Creation Date : 10/19/14
+//-----------------------------------------------------------------------------
+class N_LAS_ThreadedLUSolver : public N_LAS_Solver
+{
+
+public:
+  // Constructor
+  N_LAS_ThreadedLUSolver( N_LAS_Problem & prob,
+                          N_UTL_OptionBlock & options );
+
+  // Destructor
+  ~N_LAS_ThreadedLUSolver();
+
+  // Set the solver options
+  bool setOptions(const N_UTL_OptionBlock & OB);
+  bool setDefaultOptions();
+  bool setDefaultOption( const std::string & option );
+
+  // Set individual options
+  bool setParam( const N_UTL_Param & param );
+
+  // Get info such as Num Iterations, Residual, etc.
+  bool getInfo( N_UTL_Param & info );
+
+  // Solve function: x = A^(-1) b.
+  // input parameter 'ReuseFactors': If 'true', do not factor A, rather reuse
+  // factors from previous solve.  Useful for inexact nonlinear techniques and
+  // multiple RHS solves.
+  int solve( bool ReuseFactors = false );
+
+private:
+
+  // Factor the matrix of prob, refactoring on the kept pattern if possible
+  int factor_( Epetra_LinearProblem & prob );
+
+  // Iterative refinement of x against the double precision matrix.
+  // Returns false if it stalls before reaching double precision accuracy.
+  bool refine_( double * x, const double * b );
+
+  //Primary problem access
+  N_LAS_Problem & lasProblem_;
+  Epetra_LinearProblem & problem_;
+
+  //Threads for the refactorization, 0 for one per processor
+  int numThreads_;
+
+  //Partial pivoting threshold
+  double pivotTol_;
+
+  //Refactor only the columns that depend on changed entries
+  bool partial_;
+
+  //Number of refactorizations that had to repivot
+  int numRepivots_;
+
+  //Single precision factors with iterative refinement
+  bool single_;
+  int refineMax_;
+
+  //Refinement steps of the last solve, and solves that fell back to double
+  int numRefines_;
+  int numFallbacks_;
+
+  // Transform Support
+  Teuchos::RCP<N_LAS_Transform> transform_;
+  Epetra_LinearProblem * tProblem_;
+
+  // Serialized Matrix (if using parallel load serial solve scenario)
+  Teuchos::RCP<Epetra_Map> serialMap_;
+  Teuchos::RCP<Epetra_LinearProblem> serialProblem_;
+  Teuchos::RCP<Epetra_CrsMatrix> serialMat_;
+  Teuchos::RCP<Epetra_MultiVector> serialLHS_, serialRHS_;
+  Teuchos::RCP<Epetra_Import> serialImporter_;
+
+  // Import and export matrices in parallel load serial solve scenario
+  Epetra_LinearProblem * importToSerial();
+  int exportToGlobal();
+
+  // Compressed rows of the matrix as handed to the factorization
+  std::vector<int> rowPtr_, colInd_;
+  std::vector<double> values_;
+  double normA_;
+
+  // Residual for the iterative refinement
+  std::vector<double> refineWork_;
+
+  // Factors
+  N_LAS_LevelLU lu_;
+  bool factored_;
+
+  //Options
+  N_UTL_OptionBlock * options_;
+
+  //Timer
+  N_UTL_Timer * timer_;
+
+};
+
+#endif
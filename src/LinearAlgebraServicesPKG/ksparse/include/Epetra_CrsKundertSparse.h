@@ -33,6 +33,8 @@
 #ifndef EPETRA_CRSKUNDERTSPARSE_H
 #define EPETRA_CRSKUNDERTSPARSE_H
 
+#include <vector>
+
 class Epetra_LinearProblem;
 class Epetra_CrsMatrix;
 class Epetra_MultiVector;
@@ -159,9 +161,35 @@ class Epetra_CrsKundertSparse {
   int Solve(const bool ComputeFactor = true);
   //@}
 
+  //@{ \name Static pivot refactorization.
+  //! Refactor with the pivot sequence of the last Sparse ordering over flat arrays.
+  /*! When enabled, the first factorization (and any reordering after it) records the row and column
+      permutations chosen by Sparse and the fill pattern they produce, in compressed rows.  Later
+      factorizations replay the elimination over those arrays instead of walking Sparse's linked
+      lists, and the solves use the flat factors.  A pivot smaller than AbsThreshold or smaller than
+      RelThreshold times the largest entry of its row of U fails the factorization, which then falls
+      back to spOrderAndFactor so Sparse can reorder.  Enabled by default.
+  */
+  void SetStaticPivoting(const bool Flag) { StaticPivoting_ = Flag; }
+  bool StaticPivoting() const { return StaticPivoting_; }
+
+  //! Number of factorizations that fell back to Sparse since construction.
+  int NumPivotFallbacks() const { return NumPivotFallbacks_; }
+  //@}
+
+  //@{ \name Statistics.
+  //! Number of fill-ins created by the factorization, zero before the first Solve() and off processor 0.
+  int NumFillins() const;
+  //@}
+
  private:
 
   void deleteArrays();
+
+  int loadSparse(const Epetra_CrsMatrix & A);
+  void buildStaticPattern(const Epetra_CrsMatrix & A);
+  bool staticFactor(const Epetra_CrsMatrix & A);
+  void staticSolve(const double * rhs, double * solution);
   double RelThreshold_;
   double AbsThreshold_;
   int DiagPivoting_;
@@ -179,6 +207,19 @@ class Epetra_CrsKundertSparse {
   double **addr_list_;
 
   bool FirstSolve_;
+
+  // Static pivot refactorization, rows and columns in pivot order.
+  bool StaticPivoting_;
+  bool StaticFactored_;          // Current factors are in LUValues_, not in Sparse
+  int NumPivotFallbacks_;
+  std::vector<int> RowPerm_;     // External row of each pivot row
+  std::vector<int> ColPerm_;     // External column of each pivot column
+  std::vector<int> RowStart_;
+  std::vector<int> ColIndex_;
+  std::vector<int> DiagPos_;
+  std::vector<int> SourcePos_;   // Position in LUValues_ of each matrix entry, in row order
+  std::vector<double> LUValues_;
+  std::vector<double> Work_;
 };
 
 #endif // EPETRA_CRSKUNDERTSPARSE_H
@@ -360,6 +360,7 @@ extern  int      spGetAdmittance( char*, int, int, struct spTemplate* );
 extern  spREAL  *spGetElement( char*, int, int );
 extern  char    *spGetInitInfo( spREAL* );
 extern  int      spGetOnes( char*, int, int, int, struct spTemplate* );
+extern  int      spGetPivotOrder( char*, int*, int* );
 extern  int      spGetQuad( char*, int, int, int, int, struct spTemplate* );
 extern  int      spGetSize( char*, int );
 extern  int      spInitialize( char*, int (*)() );
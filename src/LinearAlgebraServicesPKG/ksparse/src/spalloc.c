@@ -67,6 +67,7 @@
  *  spSetComplex
  *  spFillinCount
  *  spElementCount
+ *  spGetPivotOrder
  *
  *  >>> Other functions contained in this file:
  *  spcGetElement
@@ -1082,3 +1083,44 @@ char  *eMatrix;
     ASSERT( IS_SPARSE( (MatrixPtr)eMatrix ) );
     return ((MatrixPtr)eMatrix)->Elements;
 }
+
+
+
+
+
+/*
+ *  PIVOT ORDER
+ *
+ *  Copies the row and column permutations of the last ordering.  Internal
+ *  row (column) I+1 of the factored matrix is external row (column)
+ *  IntToExtRow[I]+1, both arrays are zero based and hold Size entries.
+ *  Returns the size of the matrix.
+ *
+ *  >>> Arguments:
+ *  eMatrix  <input>  (char *)
+ *      Pointer to matrix.
+ *  IntToExtRow  <output>  (int *)
+ *      Zero based external row of each internal row.
+ *  IntToExtCol  <output>  (int *)
+ *      Zero based external column of each internal column.
+ */
+
+int
+spGetPivotOrder( eMatrix, IntToExtRow, IntToExtCol )
+
+char  *eMatrix;
+int  *IntToExtRow;
+int  *IntToExtCol;
+{
+MatrixPtr  Matrix = (MatrixPtr)eMatrix;
+int  I;
+
+/* Begin `spGetPivotOrder'. */
+
+    ASSERT( IS_SPARSE( Matrix ) );
+    for (I = 1; I <= Matrix->Size; I++)
+    {   IntToExtRow[I-1] = Matrix->IntToExtRowMap[I] - 1;
+        IntToExtCol[I-1] = Matrix->IntToExtColMap[I] - 1;
+    }
+    return Matrix->Size;
+}
@@ -137,6 +137,8 @@ public:
   bool loadBVectorsforAC (N_LAS_Vector * bVecRealPtr,
                           N_LAS_Vector * bVecImagPtr);
 
+  void checkLoadErrors();
+
   bool getBMatrixEntriesforMOR(std::vector<int>& bMatEntriesVec, std::vector<int>& bMatPosEntriesVec);
 
   // Function for setting the initial guess.
@@ -402,6 +404,19 @@ inline bool N_LOA_CktLoader::loadBVectorsforAC
                                           bVecImagPtr);
 }
 
+//-----------------------------------------------------------------------------
+// Function      : N_LOA_CktLoader::checkLoadErrors
+// Purpose       :
+// Special Notes :
+// Scope         : public
+// Creator       : Xyce Development Team, SNL
+// Creation Date : 10/19/14
+//-----------------------------------------------------------------------------
+inline void N_LOA_CktLoader::checkLoadErrors()
+{
+  deviceIntPtr->checkLoadErrors();
+}
+
 //-----------------------------------------------------------------------------
 // Function      : N_LOA_CktLoader::getBMatrixStampforMOR
 // Purpose       :
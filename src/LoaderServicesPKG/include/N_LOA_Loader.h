@@ -183,6 +183,10 @@ public:
                                   N_LAS_Vector * bVecImagPtr)
   { return false; }
 
+  // Collective check for errors reported during loads that no nonlinear
+  // solver norm follows.
+  virtual void checkLoadErrors() {}
+
   virtual bool getBMatrixEntriesforMOR(std::vector<int>& bMatEntriesVec, std::vector<int>& bMatPosEntriesVec)
   { return false; }
 
@@ -234,6 +238,16 @@ public:
   // This is somewhat circuit-specific, unfortunately.
   virtual bool getLimiterFlag() { return false; }
 
+  // Leave the parts of the problem that only depend on the flagged, fixed,
+  // solution entries out of the loads.  No flags loads everything again.
+  virtual void setLatency(const std::vector<char> & latentLIDs) {}
+
+  // Node and branch LIDs of every voltage source, ground is -1.
+  virtual void getAllVsrcLIDs(std::vector<int> & li_Pos, std::vector<int> & li_Neg, std::vector<int> & li_Bra)
+  {
+    li_Pos.clear(); li_Neg.clear(); li_Bra.clear();
+  }
+
   // Virtual method which gets the double DC Operating Point flag - used for
   // PDE devices.
   virtual bool getDoubleDCOPFlag() { return false; }
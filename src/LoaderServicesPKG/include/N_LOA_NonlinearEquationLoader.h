@@ -129,6 +129,11 @@ public:
   // Get the voltage limiter flag:
   bool getLimiterFlag ();
 
+  // Leave latent device instances out of the loads.
+  void setLatency(const std::vector<char> & latentLIDs);
+
+  void getAllVsrcLIDs(std::vector<int> & li_Pos, std::vector<int> & li_Neg, std::vector<int> & li_Bra);
+
   // Gets the double DC Operating Point flag - used for PDE devices.
   bool getDoubleDCOPFlag();
   bool output();
@@ -393,6 +398,32 @@ inline bool N_LOA_NonlinearEquationLoader::getLimiterFlag ()
   return N_LOA_NonlinearEquationLoader::deviceIntPtr->getVoltageLimiterFlag ();
 }
 
+//-----------------------------------------------------------------------------
+// Function      : N_LOA_NonlinearEquationLoader::setLatency
+// Purpose       :
+// Special Notes :
+// Scope         : public
+// Creator       : Xyce Development Team, SNL
+// Creation Date : 10/19/14
+//-----------------------------------------------------------------------------
+inline void N_LOA_NonlinearEquationLoader::setLatency(const std::vector<char> & latentLIDs)
+{
+  N_LOA_NonlinearEquationLoader::deviceIntPtr->setLatency(latentLIDs);
+}
+
+//-----------------------------------------------------------------------------
+// Function      : N_LOA_NonlinearEquationLoader::getAllVsrcLIDs
+// Purpose       :
+// Special Notes :
+// Scope         : public
+// Creator       : Xyce Development Team, SNL
+// Creation Date : 10/19/14
+//-----------------------------------------------------------------------------
+inline void N_LOA_NonlinearEquationLoader::getAllVsrcLIDs(std::vector<int> & li_Pos, std::vector<int> & li_Neg, std::vector<int> & li_Bra)
+{
+  N_LOA_NonlinearEquationLoader::deviceIntPtr->getAllVsrcLIDs(li_Pos, li_Neg, li_Bra);
+}
+
 //-----------------------------------------------------------------------------
 // Function      : N_LOA_NonlinearEquationLoader::getResidualTime
 // Purpose       : Returns timing information from residual load.
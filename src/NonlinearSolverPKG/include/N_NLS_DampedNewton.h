@@ -47,9 +47,12 @@
 #ifndef Xyce_N_NLS_DampedNewton_h
 #define Xyce_N_NLS_DampedNewton_h
 
+#include <vector>
+
 #include <N_IO_fwd.h>
 #include <N_NLS_NonLinearSolver.h>
 #include <N_NLS_NLParams.h>
+#include <N_NLS_Latency.h>
 #include <N_NLS_ParamMgr.h>
 #include <N_NLS_ReturnCodes.h>
 
@@ -117,6 +120,7 @@ private:
   void printStepInfo_(std::ostream &os, int step);
 
   bool rhs_();
+  bool jacobian_();
   bool newton_();
 
   void direction_();
@@ -135,7 +139,14 @@ private:
   double constrain_();
   void   setForcing_(const double);
   void   evalModNewton_();
+  void   startChord_();
+  void   evalChord_();
+  void   broydenDirection_();
+  void   saveBroydenStep_();
   int    converged_();
+  void   updateLatency_();
+  bool   wakeLatency_();
+  void   resetLatency_();
 
   void resetCountersAndTimers_();
 
@@ -226,6 +237,26 @@ private:
   double tmpConvRate;
 
   int count;
+
+  // Jacobian reuse across time steps (CHORDSTEPS).  chordValid_ is set
+  // when a transient solve converges, so the next step may start from its
+  // factors; chordAlpha_ is alpha/h of the loaded Jacobian and chordScale_
+  // the correction for a later alpha/h.
+  bool chordActive_;
+  bool chordValid_;
+  unsigned chordSteps_;
+  int chordStepNumber_;
+  double chordAlpha_;
+  double chordScale_;
+
+  // Steps taken on the current factors, for the Broyden corrections
+  std::vector<N_LAS_Vector*> broydenSteps_;
+  std::vector<double> broydenNormSq_;
+  unsigned numBroyden_;
+
+  // Blocks of the circuit frozen between time steps (LATENCYSTEPS)
+  N_NLS_Latency latency_;
+  bool latencyEnabled_;
 };
 
 //---------------------------------------------------------------------------
@@ -0,0 +1,153 @@
+//-----------------------------------------------------------------------------
+// Copyright Notice
+//
+//   Copyright 2002 Sandia Corporation. Under the terms
+//   of Contract DE-AC04-94AL85000 with Sandia Corporation, the U.S.
+//   Government retains certain rights in this software.
+//
+//    Xyce(TM) Parallel Electrical Simulator
+//    Copyright (C) 2002-2014 Sandia Corporation
+//
+//    This program is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License
+//    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// Filename       : $RCSfile: N_NLS_Latency.h,v $
+//
+// Purpose        : Freezes the latent blocks of a transient problem
+//
+// Special Notes  : The blocks are the diagonal blocks of the block
+//                  triangular form of the first transient Jacobian, each a
+//                  set of equations together with the unknowns they are
+//                  solved for.  A block whose unknowns have changed by less
+//                  than LATENCYTOL error weights per step for LATENCYSTEPS
+//                  accepted steps is frozen: its unknowns are held at their
+//                  values, its equations are replaced by x = const in the
+//                  Newton system, and the devices that only touch frozen
+//                  unknowns are left out of the loads.
+//
+//                  The residual of the frozen equations is still computed
+//                  from the active devices on their boundary.  A block whose
+//                  residual exceeds the Newton tolerance when the active
+//                  part has converged is woken and the step continues, so
+//                  an input change that reaches a latent block wakes it.
+//
+// Creator        : Xyce Development Team, SNL
+//
+// Creation Date  : 10/19/14
+//
+// Revision Information:
+// ---------------------
+//
+// Revision Number: $Revision: 1.1 $
+//
+// Revision Date  : $Date: 2014/10/19 00:00:00 $
+//
+// Current Owner  : $Author$
+//-----------------------------------------------------------------------------
+
+#ifndef Xyce_N_NLS_Latency_h
+#define Xyce_N_NLS_Latency_h
+
+// ----------   Standard Includes   ----------
+
+#include <vector>
+
+// ----------   Xyce Includes   ----------
+
+#include <N_LAS_BlockTriangular.h>
+
+// ----------   Fwd Declarations  ----------
+
+class N_LAS_Matrix;
+class N_LAS_Vector;
+class N_NLS_NLParams;
+
+//-----------------------------------------------------------------------------
+// Class         : N_NLS_Latency
+// Purpose       : Tracks which blocks of the circuit are latent
+// Special Notes : Only the owned rows are considered, and a block with an
+//                 entry in a ghost column is never frozen.
+// Creator       : Xyce Development Team, SNL
+// Creation Date : 10/19/14
+//-----------------------------------------------------------------------------
+class N_NLS_Latency
+{
+public:
+  N_NLS_Latency();
+
+  // Find the blocks from the pattern of the Jacobian.  The node and branch
+  // LIDs of the voltage sources, ground being -1, mark the nodes they hold.
+  void analyze( N_LAS_Matrix & jacobian,
+                const std::vector<int> & srcPosLIDs,
+                const std::vector<int> & srcNegLIDs,
+                const std::vector<int> & srcBraLIDs );
+  bool analyzed() const { return analyzed_; }
+
+  // Called before the first load of each time step with the last accepted
+  // solution.  Updates how long each block has been quiet and freezes the
+  // ones quiet for long enough.  Returns true if the latent set changed.
+  bool beginStep( int stepNumber, const N_LAS_Vector & x, const N_NLS_NLParams & params );
+
+  // Hold the latent unknowns of x at their values in held.
+  void holdLatent( N_LAS_Vector & x, const N_LAS_Vector & held ) const;
+
+  // Note the latent equations whose residual exceeds tol, then zero them.
+  void maskResidual( N_LAS_Vector & rhs, double tol );
+
+  // Replace the latent equations by x = const and drop the latent unknowns
+  // from the others.
+  void maskJacobian( N_LAS_Matrix & jacobian );
+
+  // True if the last maskResidual found a latent block to wake.
+  bool wakePending() const { return wakePending_; }
+
+  // Wake the blocks found by maskResidual.  Returns true if any woke.
+  bool wake();
+
+  // Wake every block and forget the quiet counts.  Returns true if the
+  // latent set changed.
+  bool reset();
+
+  bool active() const { return numLatentRows_ > 0; }
+
+  // Nonzero for each solution LID whose equation and unknown are latent
+  const std::vector<char> & latentLIDs() const { return latentLID_; }
+
+  int numLatentRows() const { return numLatentRows_; }
+
+private:
+  void updateLatentSets_();
+
+  N_LAS_BlockTriangular btf_;
+  bool analyzed_;
+
+  // Per block: may it be frozen, is it, steps it has been quiet, and
+  // whether the last residual asks to wake it
+  std::vector<char> eligible_;
+  std::vector<char> latent_;
+  std::vector<unsigned> quiet_;
+  std::vector<char> wake_;
+  bool wakePending_;
+
+  // Last accepted solution and its step number
+  std::vector<double> lastX_;
+  int lastStep_;
+
+  // Per row and column of the local matrix
+  std::vector<char> latentRow_, latentCol_, latentLID_;
+  int numLatentRows_;
+};
+
+#endif // Xyce_N_NLS_Latency_h
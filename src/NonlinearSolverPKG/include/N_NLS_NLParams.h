@@ -203,6 +203,26 @@ public:
   inline void     resetGlobalBTChange();
   inline double   getGlobalBTChange() const;
 
+  inline void     setChordSteps(unsigned value);
+  inline void     resetChordSteps();
+  inline unsigned getChordSteps() const;
+
+  inline void     setChordRate(double value);
+  inline void     resetChordRate();
+  inline double   getChordRate() const;
+
+  inline void     setBroydenUpdates(unsigned value);
+  inline void     resetBroydenUpdates();
+  inline unsigned getBroydenUpdates() const;
+
+  inline void     setLatencySteps(unsigned value);
+  inline void     resetLatencySteps();
+  inline unsigned getLatencySteps() const;
+
+  inline void     setLatencyTol(double value);
+  inline void     resetLatencyTol();
+  inline double   getLatencyTol() const;
+
     void printParams(std::ostream &os);
 
   inline void setDebugLevel(int value);
@@ -307,6 +327,19 @@ protected:
   double globalBTMin_;
   double globalBTChange_;
 
+  // Jacobian reuse across time steps: the number of steps one factored
+  // Jacobian may serve, the residual convergence rate above which it is
+  // reloaded, and the number of Broyden rank-one corrections kept.
+  unsigned chordSteps_;
+  double chordRate_;
+  unsigned broydenUpdates_;
+
+  // Latency: the number of time steps a block of the Jacobian must stay
+  // within latencyTol_ (in units of the solution error weights) before it
+  // is frozen.  Zero never freezes any.
+  unsigned latencySteps_;
+  double latencyTol_;
+
   // Debug output options:
   int debugLevel_;
   int debugMinTimeStep_;
@@ -1194,6 +1227,214 @@ inline double N_NLS_NLParams::getGlobalBTChange() const
   return globalBTChange_;
 }
 
+//-----------------------------------------------------------------------------
+// Function      : N_NLS_NLParams::setChordSteps
+// Purpose       : Accessor method to set the number of time steps that may
+//                 reuse one factored Jacobian.
+// Special Notes : Zero reloads the Jacobian at every time step.
+// Scope         : public
+// Creator       : Xyce Development Team, SNL
+// Creation Date : 10/19/14
+//-----------------------------------------------------------------------------
+inline void N_NLS_NLParams::setChordSteps(unsigned value)
+{
+  chordSteps_ = value;
+}
+
+//-----------------------------------------------------------------------------
+// Function      : N_NLS_NLParams::resetChordSteps
+// Purpose       : Accessor method to reset the Jacobian reuse to the default.
+// Special Notes :
+// Scope         : public
+// Creator       : Xyce Development Team, SNL
+// Creation Date : 10/19/14
+//-----------------------------------------------------------------------------
+inline void N_NLS_NLParams::resetChordSteps()
+{
+  chordSteps_ = 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function      : N_NLS_NLParams::getChordSteps
+// Purpose       : Accessor method to get the number of time steps that may
+//                 reuse one factored Jacobian.
+// Special Notes :
+// Scope         : public
+// Creator       : Xyce Development Team, SNL
+// Creation Date : 10/19/14
+//-----------------------------------------------------------------------------
+inline unsigned N_NLS_NLParams::getChordSteps() const
+{
+  return chordSteps_;
+}
+
+//-----------------------------------------------------------------------------
+// Function      : N_NLS_NLParams::setChordRate
+// Purpose       : Accessor method to set the residual convergence rate above
+//                 which a reused Jacobian is reloaded.
+// Special Notes :
+// Scope         : public
+// Creator       : Xyce Development Team, SNL
+// Creation Date : 10/19/14
+//-----------------------------------------------------------------------------
+inline void N_NLS_NLParams::setChordRate(double value)
+{
+  chordRate_ = value;
+}
+
+//-----------------------------------------------------------------------------
+// Function      : N_NLS_NLParams::resetChordRate
+// Purpose       : Accessor method to reset the reload convergence rate to
+//                 the default.
+// Special Notes :
+// Scope         : public
+// Creator       : Xyce Development Team, SNL
+// Creation Date : 10/19/14
+//-----------------------------------------------------------------------------
+inline void N_NLS_NLParams::resetChordRate()
+{
+  chordRate_ = 0.25;
+}
+
+//-----------------------------------------------------------------------------
+// Function      : N_NLS_NLParams::getChordRate
+// Purpose       : Accessor method to get the residual convergence rate above
+//                 which a reused Jacobian is reloaded.
+// Special Notes :
+// Scope         : public
+// Creator       : Xyce Development Team, SNL
+// Creation Date : 10/19/14
+//-----------------------------------------------------------------------------
+inline double N_NLS_NLParams::getChordRate() const
+{
+  return chordRate_;
+}
+
+//-----------------------------------------------------------------------------
+// Function      : N_NLS_NLParams::setBroydenUpdates
+// Purpose       : Accessor method to set the number of Broyden rank-one
+//                 corrections applied to a reused Jacobian.
+// Special Notes :
+// Scope         : public
+// Creator       : Xyce Development Team, SNL
+// Creation Date : 10/19/14
+//-----------------------------------------------------------------------------
+inline void N_NLS_NLParams::setBroydenUpdates(unsigned value)
+{
+  broydenUpdates_ = value;
+}
+
+//-----------------------------------------------------------------------------
+// Function      : N_NLS_NLParams::resetBroydenUpdates
+// Purpose       : Accessor method to reset the number of Broyden
+//                 corrections to the default.
+// Special Notes :
+// Scope         : public
+// Creator       : Xyce Development Team, SNL
+// Creation Date : 10/19/14
+//-----------------------------------------------------------------------------
+inline void N_NLS_NLParams::resetBroydenUpdates()
+{
+  broydenUpdates_ = 8;
+}
+
+//-----------------------------------------------------------------------------
+// Function      : N_NLS_NLParams::getBroydenUpdates
+// Purpose       : Accessor method to get the number of Broyden rank-one
+//                 corrections applied to a reused Jacobian.
+// Special Notes :
+// Scope         : public
+// Creator       : Xyce Development Team, SNL
+// Creation Date : 10/19/14
+//-----------------------------------------------------------------------------
+inline unsigned N_NLS_NLParams::getBroydenUpdates() const
+{
+  return broydenUpdates_;
+}
+
+//-----------------------------------------------------------------------------
+// Function      : N_NLS_NLParams::setLatencySteps
+// Purpose       : Accessor method to set the number of quiet time steps
+//                 after which a block of the circuit is frozen.
+// Special Notes : Zero turns latency off.
+// Scope         : public
+// Creator       : Xyce Development Team, SNL
+// Creation Date : 10/19/14
+//-----------------------------------------------------------------------------
+inline void N_NLS_NLParams::setLatencySteps(unsigned value)
+{
+  latencySteps_ = value;
+}
+
+//-----------------------------------------------------------------------------
+// Function      : N_NLS_NLParams::resetLatencySteps
+// Purpose       : Accessor method to reset latency to the default (off).
+// Special Notes :
+// Scope         : public
+// Creator       : Xyce Development Team, SNL
+// Creation Date : 10/19/14
+//-----------------------------------------------------------------------------
+inline void N_NLS_NLParams::resetLatencySteps()
+{
+  latencySteps_ = 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function      : N_NLS_NLParams::getLatencySteps
+// Purpose       : Accessor method to get the number of quiet time steps
+//                 after which a block of the circuit is frozen.
+// Special Notes :
+// Scope         : public
+// Creator       : Xyce Development Team, SNL
+// Creation Date : 10/19/14
+//-----------------------------------------------------------------------------
+inline unsigned N_NLS_NLParams::getLatencySteps() const
+{
+  return latencySteps_;
+}
+
+//-----------------------------------------------------------------------------
+// Function      : N_NLS_NLParams::setLatencyTol
+// Purpose       : Accessor method to set the weighted change per time step
+//                 below which a block counts as quiet.
+// Special Notes :
+// Scope         : public
+// Creator       : Xyce Development Team, SNL
+// Creation Date : 10/19/14
+//-----------------------------------------------------------------------------
+inline void N_NLS_NLParams::setLatencyTol(double value)
+{
+  latencyTol_ = value;
+}
+
+//-----------------------------------------------------------------------------
+// Function      : N_NLS_NLParams::resetLatencyTol
+// Purpose       : Accessor method to reset the latency tolerance to the
+//                 default.
+// Special Notes :
+// Scope         : public
+// Creator       : Xyce Development Team, SNL
+// Creation Date : 10/19/14
+//-----------------------------------------------------------------------------
+inline void N_NLS_NLParams::resetLatencyTol()
+{
+  latencyTol_ = 0.1;
+}
+
+//-----------------------------------------------------------------------------
+// Function      : N_NLS_NLParams::getLatencyTol
+// Purpose       : Accessor method to get the weighted change per time step
+//                 below which a block counts as quiet.
+// Special Notes :
+// Scope         : public
+// Creator       : Xyce Development Team, SNL
+// Creation Date : 10/19/14
+//-----------------------------------------------------------------------------
+inline double N_NLS_NLParams::getLatencyTol() const
+{
+  return latencyTol_;
+}
+
 //-----------------------------------------------------------------------------
 // Function      : N_NLS_NLParams::setDebugLevel
 // Purpose       :
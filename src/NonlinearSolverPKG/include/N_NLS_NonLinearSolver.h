@@ -74,6 +74,7 @@ class N_LAS_System;
 
 class N_LAS_Solver;
 class N_LAS_Problem;
+class N_LAS_SystemArchiveWriter;
 
 class N_LOA_Loader;
 
@@ -225,6 +226,7 @@ protected:
   N_LAS_Vector* solWtVectorPtr_;
   N_LAS_System* lasSysPtr_;
   N_LAS_Solver * lasSolverPtr_;
+  N_LAS_SystemArchiveWriter * systemArchivePtr_;     // shared, not owned
   RefCountPtr<N_LAS_Problem> lasProblemRCPtr_;
   RefCountPtr<N_LAS_PrecondFactory> lasPrecPtr_;
   N_UTL_OptionBlock* petraOptionBlockPtr_;
@@ -248,6 +250,9 @@ protected:
   N_NLS_ReturnCodes retCodes_;
   bool matrixFreeFlag_;
 
+  // Solve with the factors of the last solve instead of the current matrix
+  bool reuseFactors_;
+
   N_IO_CmdParse & commandLine_;
 
   friend class N_NLS_ConductanceExtractor;
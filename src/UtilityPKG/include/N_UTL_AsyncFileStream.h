@@ -0,0 +1,160 @@
+//-------------------------------------------------------------------------
+//   Copyright 2002-2014 Sandia Corporation. Under the terms
+//   of Contract DE-AC04-94AL85000 with Sandia Corporation, the U.S.
+//   Government retains certain rights in this software.
+//
+//    Xyce(TM) Parallel Electrical Simulator
+//    Copyright (C) 2002-2014 Sandia Corporation
+//
+//    This program is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License
+//    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//-------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------
+// Filename       : $RCSfile: N_UTL_AsyncFileStream.h,v $
+//
+// Purpose        : Output file stream whose file I/O is done by a
+//                  background writer thread.
+//
+// Special Notes  : Characters are collected into fixed size blocks.  Full
+//                  blocks go onto a bounded queue that a writer thread
+//                  drains to the file.  When the queue is full the producer
+//                  waits, which bounds the memory held by a slow
+//                  filesystem.  flush() and std::endl do NOT wait for the
+//                  disk, use drain() for that.  Without POSIX threads
+//                  the blocks are written by the calling thread.
+//
+//                  tellp() and seekp() drain the queue first, so they are
+//                  only cheap when used rarely, as the RAW outputters do
+//                  to patch their headers.
+//
+// Creator        : Xyce Development Team, SNL
+//
+// Creation Date  : 10/19/14
+//
+// Revision Information:
+// ---------------------
+//
+// Revision Number: $Revision: 1.1 $
+//
+// Revision Date  : $Date: 2014/10/19 00:00:00 $
+//
+// Current Owner  : $Author$
+//-------------------------------------------------------------------------
+
+#ifndef Xyce_N_UTL_AsyncFileStream_h
+#define Xyce_N_UTL_AsyncFileStream_h
+
+#include <cstdio>
+#include <deque>
+#include <ios>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+#include <N_UTL_PThread.h>
+
+namespace Xyce {
+namespace Util {
+
+/**
+ * @brief Stream buffer that hands full blocks of characters to a writer thread.
+ */
+class AsyncFileStreambuf : public std::streambuf
+{
+  public:
+    AsyncFileStreambuf(const std::string &path, std::ios_base::openmode mode, size_t block_size = 65536, size_t max_queued_blocks = 16);
+
+    virtual ~AsyncFileStreambuf();
+
+  private:
+    AsyncFileStreambuf(const AsyncFileStreambuf &);
+    AsyncFileStreambuf &operator=(const AsyncFileStreambuf &);
+
+  public:
+    bool is_open() const
+    {
+      return file_ != 0;
+    }
+
+    /**
+     * Queue the partially filled block and wait until everything queued so far is on disk.
+     */
+    void drain();
+
+  protected:
+    virtual int_type overflow(int_type c);
+
+    virtual int sync();
+
+    virtual pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which = std::ios_base::out);
+
+    virtual pos_type seekpos(pos_type pos, std::ios_base::openmode which = std::ios_base::out);
+
+  private:
+    void queueBlock_();
+    void writeBlock_(std::vector<char> &block);
+    void run_();
+
+    static void *writerMain_(void *arg);
+
+  private:
+    FILE *                              file_;
+    const size_t                        blockSize_;
+    const size_t                        maxQueuedBlocks_;
+
+    std::vector<char> *                 current_;               ///< Block being filled by the producer
+    std::deque<std::vector<char> *>     queue_;                 ///< Full blocks waiting for the writer
+    std::vector<std::vector<char> *>    freeBlocks_;            ///< Written blocks available for reuse
+
+    bool                                threaded_;
+    bool                                stop_;
+    bool                                writing_;               ///< Writer holds a block outside the lock
+    xyce_pthread_t                      writer_;
+    xyce_pthread_mutex_t                mutex_;
+    xyce_pthread_cond_t                 notEmpty_;
+    xyce_pthread_cond_t                 notFull_;
+};
+
+/**
+ * @brief std::ostream writing through an AsyncFileStreambuf.
+ */
+class AsyncFileStream : public std::ostream
+{
+  public:
+    AsyncFileStream(const std::string &path, std::ios_base::openmode mode = std::ios_base::out)
+      : std::ostream(0),
+        streambuf_(path, mode)
+    {
+      init(&streambuf_);
+      if (!streambuf_.is_open())
+        setstate(std::ios_base::failbit);
+    }
+
+    virtual ~AsyncFileStream()
+    {}
+
+    void drain()
+    {
+      streambuf_.drain();
+    }
+
+  private:
+    AsyncFileStreambuf          streambuf_;
+};
+
+} // namespace Util
+} // namespace Xyce
+
+#endif // Xyce_N_UTL_AsyncFileStream_h
@@ -0,0 +1,165 @@
+//-----------------------------------------------------------------------------
+// Copyright Notice
+//
+//   Copyright 2002 Sandia Corporation. Under the terms
+//   of Contract DE-AC04-94AL85000 with Sandia Corporation, the U.S.
+//   Government retains certain rights in this software.
+//
+//    Xyce(TM) Parallel Electrical Simulator
+//    Copyright (C) 2002-2014 Sandia Corporation
+//
+//    This program is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License
+//    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//-----------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------
+// Filename       : $RCSfile: N_UTL_NameTable.h,v $
+//
+// Purpose        : Interned, case insensitive hierarchical names
+//
+// Special Notes  : A hierarchical name such as "XTOP:XCELL:M1" is stored as
+//                  a chain of components, each holding its parent's id and
+//                  its own text, so the "XTOP:XCELL" prefix is stored once
+//                  however many names share it.  Each component carries a
+//                  hash of its case folded text, so looking a name up is a
+//                  hash probe per component and only compares text on a
+//                  hash match.
+//
+//                  Ids are dense, start at zero and are never reused, so
+//                  they can index vectors.  Names compare equal, and get
+//                  the same id, if they are equal ignoring case.
+//
+// Creator        : Xyce Development Team, SNL
+//
+// Creation Date  : 10/19/14
+//
+// Revision Information:
+// ---------------------
+//
+// Revision Number: $Revision: 1.1 $
+//
+// Revision Date  : $Date: 2014/10/19 00:00:00 $
+//
+// Current Owner  : $Author$
+//-------------------------------------------------------------------------
+
+#ifndef Xyce_N_UTL_NameTable_h
+#define Xyce_N_UTL_NameTable_h
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Xyce {
+namespace Util {
+
+typedef int NameId;
+
+/**
+ * Separator between the components of a hierarchical name.
+ */
+const char NAME_SEPARATOR = ':';
+
+/**
+ * @brief Store of interned hierarchical names.
+ */
+class NameTable
+{
+  public:
+    enum { NONE = -1 };
+
+    NameTable();
+
+    /**
+     * Intern the hierarchical name and return its id.
+     */
+    NameId intern(const std::string &name);
+
+    /**
+     * Intern the hierarchical name relative to parent, or at the top level
+     * if parent is NONE, so intern(intern("XTOP"), "XCELL:M1") is the id
+     * of "XTOP:XCELL:M1".
+     */
+    NameId intern(NameId parent, const std::string &name);
+
+    /**
+     * Return the id of name, or NONE if it has never been interned.
+     */
+    NameId find(const std::string &name) const;
+
+    NameId find(NameId parent, const std::string &name) const;
+
+    NameId parent(NameId id) const
+    {
+      return entries_[id].parent_;
+    }
+
+    /**
+     * Text of the last component of id, as spelled when first interned.
+     */
+    const std::string &leaf(NameId id) const
+    {
+      return entries_[id].leaf_;
+    }
+
+    /**
+     * Full hierarchical name of id.
+     */
+    std::string name(NameId id) const;
+
+    /**
+     * Case insensitive hash of the whole name of id.
+     */
+    unsigned hash(NameId id) const
+    {
+      return entries_[id].hash_;
+    }
+
+    std::size_t size() const
+    {
+      return entries_.size();
+    }
+
+    void clear();
+
+  private:
+    struct Entry
+    {
+      Entry(NameId parent, unsigned hash, const char *leaf, std::size_t length)
+        : parent_(parent),
+          hash_(hash),
+          leaf_(leaf, length)
+      {}
+
+      NameId            parent_;
+      unsigned          hash_;
+      std::string       leaf_;
+    };
+
+    NameId find_(NameId parent, const char *leaf, std::size_t length, unsigned hash) const;
+    NameId insert_(NameId parent, const char *leaf, std::size_t length);
+    void rehash_(std::size_t bucket_count);
+
+    std::vector<Entry>  entries_;
+    std::vector<NameId> buckets_;           ///< Open addressing, size a power of two
+};
+
+/**
+ * The process wide name table.
+ */
+NameTable &nameTable();
+
+} // namespace Util
+} // namespace Xyce
+
+#endif // Xyce_N_UTL_NameTable_h
@@ -46,17 +46,25 @@
 #ifndef Xyce_N_UTL_PThread_h
 #define Xyce_N_UTL_PThread_h
 
-#ifdef USE_THREADS
+#if defined(USE_THREADS) || defined(HAVE_PTHREAD)
 #include <pthread.h>
 #endif
 
 namespace Xyce {
 namespace Util {
 
-#ifdef USE_THREADS
+#if defined(USE_THREADS) || defined(HAVE_PTHREAD)
 typedef ::pthread_t xyce_pthread_t;
 typedef ::pthread_attr_t xyce_pthread_attr_t;
 typedef ::pthread_mutex_t xyce_pthread_mutex_t;
+typedef ::pthread_cond_t xyce_pthread_cond_t;
+
+// True if xyce_pthread_create starts a thread rather than running the
+// routine in the caller.
+inline bool xyce_pthread_available()
+{
+  return true;
+}
 
 inline xyce_pthread_t xyce_pthread_self() 
 {
@@ -83,11 +91,47 @@ inline int xyce_pthread_join(xyce_pthread_t __th, void **__thread_return)
   return ::pthread_join(__th, __thread_return);
 }
 
+inline int xyce_pthread_mutex_init(xyce_pthread_mutex_t *mutex) 
+{
+  return ::pthread_mutex_init(mutex, 0);
+}
+
+inline int xyce_pthread_mutex_destroy(xyce_pthread_mutex_t *mutex) 
+{
+  return ::pthread_mutex_destroy(mutex);
+}
+
+inline int xyce_pthread_cond_init(xyce_pthread_cond_t *cond) 
+{
+  return ::pthread_cond_init(cond, 0);
+}
+
+inline int xyce_pthread_cond_destroy(xyce_pthread_cond_t *cond) 
+{
+  return ::pthread_cond_destroy(cond);
+}
+
+inline int xyce_pthread_cond_wait(xyce_pthread_cond_t *cond, xyce_pthread_mutex_t *mutex) 
+{
+  return ::pthread_cond_wait(cond, mutex);
+}
+
+inline int xyce_pthread_cond_broadcast(xyce_pthread_cond_t *cond) 
+{
+  return ::pthread_cond_broadcast(cond);
+}
+
 #else
 
 typedef int xyce_pthread_t;
 typedef int xyce_pthread_attr_t;
 typedef int xyce_pthread_mutex_t;
+typedef int xyce_pthread_cond_t;
+
+inline bool xyce_pthread_available()
+{
+  return false;
+}
 
 inline xyce_pthread_t xyce_pthread_self() 
 {
@@ -116,6 +160,36 @@ inline int xyce_pthread_join(xyce_pthread_t __th, void **__thread_return)
   return 0;
 }
 
+inline int xyce_pthread_mutex_init(xyce_pthread_mutex_t *mutex) 
+{
+  return 0;
+}
+
+inline int xyce_pthread_mutex_destroy(xyce_pthread_mutex_t *mutex) 
+{
+  return 0;
+}
+
+inline int xyce_pthread_cond_init(xyce_pthread_cond_t *cond) 
+{
+  return 0;
+}
+
+inline int xyce_pthread_cond_destroy(xyce_pthread_cond_t *cond) 
+{
+  return 0;
+}
+
+inline int xyce_pthread_cond_wait(xyce_pthread_cond_t *cond, xyce_pthread_mutex_t *mutex) 
+{
+  return 0;
+}
+
+inline int xyce_pthread_cond_broadcast(xyce_pthread_cond_t *cond) 
+{
+  return 0;
+}
+
 #endif
 
 } // namespace Util
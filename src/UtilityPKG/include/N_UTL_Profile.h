@@ -0,0 +1,166 @@
+//-------------------------------------------------------------------------
+//   Copyright 2002-2014 Sandia Corporation. Under the terms
+//   of Contract DE-AC04-94AL85000 with Sandia Corporation, the U.S.
+//   Government retains certain rights in this software.
+//
+//    Xyce(TM) Parallel Electrical Simulator
+//    Copyright (C) 2002-2014 Sandia Corporation
+//
+//    This program is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License
+//    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//-------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------
+// Filename       : $RCSfile: N_UTL_Profile.h,v $
+//
+// Purpose        : Hierarchical phase profiler.
+//
+// Special Notes  : A Profile::Region is a scoped timer.  Regions nest, the
+//                  region opened inside another becomes its child, so the
+//                  same name under different parents (the device loads of
+//                  the DC operating point and of the transient, say) is
+//                  kept apart.  Each node of the tree accumulates wall
+//                  clock seconds and a call count.
+//
+//                  Entering a region is one clock read plus a scan of the
+//                  children of the current node, which keeps it cheap
+//                  enough to be always on.  The tree is only written out
+//                  when report() is called, Xyce does that at exit when
+//                  -profile <file> is on the command line.
+//
+//                  Regions belong to the main thread, do not open them
+//                  from worker threads.
+//
+// Creator        : Xyce Development Team, SNL
+//
+// Creation Date  : 10/19/14
+//
+// Revision Information:
+// ---------------------
+//
+// Revision Number: $Revision: 1.1 $
+//
+// Revision Date  : $Date: 2014/10/19 00:00:00 $
+//
+// Current Owner  : $Author$
+//-------------------------------------------------------------------------
+
+#ifndef Xyce_N_UTL_Profile_h
+#define Xyce_N_UTL_Profile_h
+
+#include <string>
+
+#include <N_PDS_ParallelMachine.h>
+
+namespace Xyce {
+namespace Util {
+namespace Profile {
+
+/**
+ * Wall clock time in seconds.
+ */
+double wallTime();
+
+/**
+ * Region timing is on unless disabled.
+ */
+bool enabled();
+
+void setEnabled(bool enabled);
+
+/**
+ * Make the child of the current node called name the current node and return its index.
+ */
+int enter(const char *name);
+
+/**
+ * Charge elapsed seconds to node and make its parent the current node.
+ */
+void leave(int node, double elapsed);
+
+/**
+ * Discard all timings.
+ */
+void reset();
+
+/**
+ * Seconds charged to the region at path, the names from the top level down separated by '/'.  Zero if the
+ * region was never entered.  Local to this rank.
+ */
+double seconds(const std::string &path);
+
+/**
+ * Seconds charged to all regions called name, wherever they are in the tree.  A region nested in one of the same
+ * name is not counted again.  Local to this rank.
+ */
+double totalSeconds(const std::string &name);
+
+/**
+ * Aggregate the tree over the ranks of comm and write it to path on rank 0.
+ *
+ * A path ending in .csv gets one row per region, anything else gets JSON.
+ * Each region reports its call count summed over ranks and the minimum,
+ * maximum and average of its seconds over ranks.  Collective over comm.
+ *
+ * @return false if rank 0 could not open path.
+ */
+bool report(Parallel::Machine comm, const std::string &path);
+
+/**
+ * @brief Scoped timer for one region of the profile tree.
+ */
+class Region
+{
+  public:
+    explicit Region(const char *name)
+      : node_(-1),
+        start_(0.0)
+    {
+      if (enabled())
+      {
+        node_ = enter(name);
+        start_ = wallTime();
+      }
+    }
+
+    explicit Region(const std::string &name)
+      : node_(-1),
+        start_(0.0)
+    {
+      if (enabled())
+      {
+        node_ = enter(name.c_str());
+        start_ = wallTime();
+      }
+    }
+
+    ~Region()
+    {
+      if (node_ >= 0)
+        leave(node_, wallTime() - start_);
+    }
+
+  private:
+    Region(const Region &);
+    Region &operator=(const Region &);
+
+  private:
+    int         node_;
+    double      start_;
+};
+
+} // namespace Profile
+} // namespace Util
+} // namespace Xyce
+
+#endif // Xyce_N_UTL_Profile_h
@@ -211,6 +211,11 @@
 #cmakedefine HAVE_OSTREAM_H
 #endif
 
+/* Define to 1 if POSIX threads are available. */
+#ifndef HAVE_PTHREAD
+#cmakedefine HAVE_PTHREAD
+#endif
+
 /* Define to 1 if you have the <stdint.h> header file. */
 #ifndef HAVE_STDINT_H
 #cmakedefine HAVE_STDINT_H
@@ -262,6 +267,11 @@
 #cmakedefine HAVE_STRCASECMP
 #endif
 
+/* Define to 1 if you have the <sys/mman.h> header file. */
+#ifndef HAVE_SYS_MMAN_H
+#cmakedefine HAVE_SYS_MMAN_H
+#endif
+
 /* Define to 1 if you have the <sys/stat.h> header file. */
 #ifndef HAVE_SYS_STAT_H
 #cmakedefine HAVE_SYS_STAT_H
@@ -0,0 +1,194 @@
+#!/usr/bin/env python
+#-------------------------------------------------------------------------------
+#
+# File: generateScalingCircuits.py
+#
+# Purpose: Generate reproducible synthetic circuits of a requested size for
+#          end to end scaling measurements, and optionally run each one
+#          through the ScalingBenchmark driver (src/test/ScalingBenchmark),
+#          which appends the per phase timings to a CSV report.
+#
+#          Families (the size is the approximate number of unknowns):
+#            rcmesh    square RC mesh driven by a pulse at one corner
+#            invchain  chain of level 1 CMOS inverters
+#            sram      6T SRAM array with word line and bit line drivers
+#            ringosc   odd stage BSIM4 ring oscillator
+#            rlcladder RLC ladder whose sections are joined by LTRA lines
+#
+# Usage:  generateScalingCircuits.py [options] family size [size ...]
+#
+#   -o DIR          directory for the netlists (default: .)
+#   --analysis A    tran (default) or op
+#   --run DRIVER    run every netlist through the ScalingBenchmark binary
+#   --report FILE   CSV report for --run (default: scaling.csv)
+#
+#   Example:
+#     generateScalingCircuits.py --run ./ScalingBenchmark rcmesh 1e3 1e4 1e5 1e6
+#
+# Date: $Date: 2014/10/19 00:00:00 $
+# Revision: $Revision: 1.1 $
+# Owner: $Author$
+#-------------------------------------------------------------------------------
+"""
+Generate synthetic scaling circuits and optionally time them.
+
+Usage:  generateScalingCircuits.py [-o DIR] [--analysis tran|op]
+                                   [--run DRIVER] [--report FILE]
+                                   family size [size ...]
+
+Families: rcmesh invchain sram ringosc rlcladder
+"""
+
+import math
+import os
+import subprocess
+import sys
+
+def analysis(out, kind, stop):
+  if kind == 'op':
+    out.write('.OP\n')
+  else:
+    out.write('.TRAN %g %g\n' % (stop / 100.0, stop))
+
+def mosModels(out, level):
+  out.write('.MODEL nch NMOS (LEVEL=%d)\n' % level)
+  out.write('.MODEL pch PMOS (LEVEL=%d)\n' % level)
+
+def rcmesh(out, size, kind):
+  n = max(2, int(math.sqrt(size)))
+  out.write('VIN in 0 PULSE(0 1 0 1n 1n 10n 20n)\n')
+  out.write('RIN in n0_0 10\n')
+  for i in range(n):
+    for j in range(n):
+      node = 'n%d_%d' % (i, j)
+      if j + 1 < n:
+        out.write('RH%d_%d %s n%d_%d 100\n' % (i, j, node, i, j + 1))
+      if i + 1 < n:
+        out.write('RV%d_%d %s n%d_%d 100\n' % (i, j, node, i + 1, j))
+      out.write('C%d_%d %s 0 10f\n' % (i, j, node))
+  analysis(out, kind, 40e-9)
+
+def inverter(out, name, a, y):
+  out.write('MP%s %s %s vdd vdd pch L=1u W=2u\n' % (name, y, a))
+  out.write('MN%s %s %s 0 0 nch L=1u W=1u\n' % (name, y, a))
+
+def invchain(out, size, kind):
+  stages = max(1, int(size))
+  out.write('VDD vdd 0 3.3\n')
+  out.write('VIN s0 0 PULSE(0 3.3 0 1n 1n 10n 20n)\n')
+  for i in range(stages):
+    inverter(out, str(i), 's%d' % i, 's%d' % (i + 1))
+  out.write('CL s%d 0 10f\n' % stages)
+  mosModels(out, 1)
+  analysis(out, kind, 40e-9)
+
+def sram(out, size, kind):
+  cells = max(1, int(size / 2))
+  cols = max(1, int(math.sqrt(cells)))
+  rows = max(1, cells // cols)
+  out.write('VDD vdd 0 3.3\n')
+  for r in range(rows):
+    out.write('VWL%d wl%d 0 PULSE(0 3.3 %gn 1n 1n 5n %gn)\n' % (r, r, 10.0 * (r % 4), 40.0))
+  for c in range(cols):
+    out.write('VBL%d bl%d 0 PULSE(0 3.3 0 1n 1n 10n 20n)\n' % (c, c))
+    out.write('VBLB%d blb%d 0 PULSE(3.3 0 0 1n 1n 10n 20n)\n' % (c, c))
+  for r in range(rows):
+    for c in range(cols):
+      cell = '%d_%d' % (r, c)
+      q = 'q' + cell
+      qb = 'qb' + cell
+      inverter(out, 'a' + cell, q, qb)
+      inverter(out, 'b' + cell, qb, q)
+      out.write('MNA%s bl%d wl%d %s 0 nch L=1u W=1u\n' % (cell, c, r, q))
+      out.write('MNB%s blb%d wl%d %s 0 nch L=1u W=1u\n' % (cell, c, r, qb))
+  mosModels(out, 1)
+  analysis(out, kind, 40e-9)
+
+def ringosc(out, size, kind):
+  # A BSIM4 inverter adds roughly seven unknowns with its internal nodes.
+  stages = max(3, int(size / 7))
+  if stages % 2 == 0:
+    stages += 1
+  out.write('VDD vdd 0 1.2\n')
+  for i in range(stages):
+    out.write('MP%d s%d s%d vdd vdd pch L=0.1u W=0.4u\n' % (i, (i + 1) % stages, i))
+    out.write('MN%d s%d s%d 0 0 nch L=0.1u W=0.2u\n' % (i, (i + 1) % stages, i))
+  out.write('.IC V(s0)=0\n')
+  mosModels(out, 14)
+  analysis(out, kind, 10e-9)
+
+def rlcladder(out, size, kind):
+  # Each section is an R-L-C ladder step followed by an LTRA segment.
+  sections = max(1, int(size / 4))
+  out.write('VIN a0 0 PULSE(0 1 0 0.1n 0.1n 2n 5n)\n')
+  for i in range(sections):
+    out.write('R%d a%d b%d 1\n' % (i, i, i))
+    out.write('L%d b%d c%d 1n\n' % (i, i, i))
+    out.write('C%d c%d 0 1p\n' % (i, i))
+    out.write('O%d c%d 0 a%d 0 line\n' % (i, i, i + 1))
+  out.write('RL a%d 0 50\n' % sections)
+  out.write('.MODEL line LTRA (R=0.1 L=1e-9 C=1e-12 LEN=1)\n')
+  analysis(out, kind, 20e-9)
+
+families = {
+  'rcmesh'    : rcmesh,
+  'invchain'  : invchain,
+  'sram'      : sram,
+  'ringosc'   : ringosc,
+  'rlcladder' : rlcladder,
+}
+
+def main(argv):
+  directory = '.'
+  kind = 'tran'
+  driver = None
+  report = 'scaling.csv'
+
+  args = argv[1:]
+  positional = []
+  while args:
+    arg = args.pop(0)
+    if arg == '-o' and args:
+      directory = args.pop(0)
+    elif arg == '--analysis' and args:
+      kind = args.pop(0)
+    elif arg == '--run' and args:
+      driver = args.pop(0)
+    elif arg == '--report' and args:
+      report = args.pop(0)
+    else:
+      positional.append(arg)
+
+  try:
+    sizes = [int(float(s)) for s in positional[1:]]
+  except ValueError:
+    sizes = []
+
+  if not sizes or positional[0] not in families or kind not in ('tran', 'op'):
+    sys.stderr.write(__doc__)
+    return 1
+
+  family = positional[0]
+  if not os.path.isdir(directory):
+    os.makedirs(directory)
+
+  status = 0
+  for size in sizes:
+    path = os.path.join(directory, '%s_%d_%s.cir' % (family, size, kind))
+    out = open(path, 'w')
+    out.write('* %s, about %d unknowns\n' % (family, size))
+    families[family](out, size, kind)
+    out.write('.END\n')
+    out.close()
+
+    if driver:
+      if subprocess.call([driver, report, path]) != 0:
+        sys.stderr.write('%s failed\n' % path)
+        status = 1
+    else:
+      print(path)
+
+  return status
+
+if __name__ == '__main__':
+  sys.exit(main(sys.argv))
@@ -0,0 +1,66 @@
+#!/usr/bin/env python
+#-------------------------------------------------------------------------------
+#
+# File: pwlToBinary.py
+#
+# Purpose: Convert a text PWL stimulus (time,value pairs, one pair per line,
+#          comma, tab or space separated) into the binary format that
+#          "PWL FILE" sources memory-map instead of parsing.
+#
+#          Layout (native byte order):
+#            char    magic[8]   "XYCEPWLB"
+#            int64   count
+#            double  time[count]
+#            double  value[count]
+#
+# Usage:  pwlToBinary.py stimulus.csv stimulus.pwlb
+#
+# Date: $Date: 2014/10/19 00:00:00 $
+# Revision: $Revision: 1.1 $
+# Owner: $Author$
+#-------------------------------------------------------------------------------
+"""
+Convert a text PWL (time,value) file into a binary PWL stimulus file.
+
+Usage:  pwlToBinary.py stimulus.csv stimulus.pwlb
+"""
+
+import re
+import struct
+import sys
+from array import array
+
+def main(argv):
+  if len(argv) != 3:
+    sys.stderr.write(__doc__)
+    return 1
+
+  times = array('d')
+  values = array('d')
+
+  splitter = re.compile(r'[\s,]+')
+  for lineNumber, line in enumerate(open(argv[1], 'r')):
+    fields = [f for f in splitter.split(line.strip()) if f]
+    if not fields:
+      continue
+    if len(fields) != 2:
+      sys.stderr.write('%s:%d: expected a time,value pair\n' % (argv[1], lineNumber + 1))
+      return 1
+    t = float(fields[0])
+    if times and t < times[-1]:
+      sys.stderr.write('%s:%d: time values must be nondecreasing\n' % (argv[1], lineNumber + 1))
+      return 1
+    times.append(t)
+    values.append(float(fields[1]))
+
+  out = open(argv[2], 'wb')
+  out.write(b'XYCEPWLB')
+  out.write(struct.pack('=q', len(times)))
+  times.tofile(out)
+  values.tofile(out)
+  out.close()
+
+  return 0
+
+if __name__ == '__main__':
+  sys.exit(main(sys.argv))